@@ -0,0 +1,934 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "MyVector.h"
+#include "MyFlatSearch.h"
+
+namespace MySTL
+{
+	//ordered map as a B+ tree. the elements sit in leaves of a few cache lines with separate key and value arrays,
+	//the inner nodes only hold separator keys and child pointers. leaves are linked in both directions so scans never climb the tree.
+	//keys and values have to be default constructible like in MyVector, searches inside a node compare all keys at once with sse
+	//for arithmetic keys ordered by std::less and fall back to the branchless binary search of MyFlatMap otherwise
+	template<typename K, typename V, typename Comp = std::less<K>>
+	class MyBTreeMap
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("BTreeMap exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<K, V>;
+	private:
+		//four cache lines of keys per node, but never fewer than 8 keys so the tree stays shallow for big keys
+		static constexpr size_t nodeBytes = 256;
+		static constexpr size_t leafCapacity = nodeBytes / sizeof(K) > 8 ? nodeBytes / sizeof(K) : 8;
+		static constexpr size_t innerCapacity = leafCapacity;
+		static constexpr size_t minLeaf = leafCapacity / 2;
+		static constexpr size_t minInner = innerCapacity / 2;
+		//every inner node but the root has at least 5 children, which is plenty for 32 levels
+		static constexpr size_t maxDepth = 32;
+		static constexpr bool simdSearch = std::is_arithmetic<K>::value && (std::is_same<Comp, std::less<K>>::value || std::is_same<Comp, std::less<>>::value);
+
+		struct Node
+		{
+			size_t count = 0; //keys in the node
+		};
+		struct Leaf : public Node
+		{
+			Leaf* prev = nullptr;
+			Leaf* next = nullptr;
+			K keys[leafCapacity];
+			V vals[leafCapacity];
+		};
+		//children[i] holds the keys from keys[i - 1] up to but not including keys[i]
+		struct Inner : public Node
+		{
+			K keys[innerCapacity];
+			Node* children[innerCapacity + 1];
+		};
+
+		template<bool IsConst>
+		class basic_iterator
+		{
+		public:
+			using map_type = typename std::conditional<IsConst, const MyBTreeMap, MyBTreeMap>::type;
+			using mapped_reference = typename std::conditional<IsConst, const V&, V&>::type;
+			using value_type = MyBTreeMap::value_type;
+			using reference = std::pair<const K&, mapped_reference>;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::bidirectional_iterator_tag;
+		private:
+			friend class MyBTreeMap;
+			template<bool> friend class basic_iterator;
+
+			map_type* map;
+			Leaf* leaf; //nullptr at the end
+			size_t index;
+
+			basic_iterator(map_type* map, Leaf* leaf, size_t index)
+				:
+				map(map),
+				leaf(leaf),
+				index(index)
+			{}
+		public:
+			//a mutable iterator converts to a const one
+			template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+			basic_iterator(const basic_iterator<WasConst>& other)
+				:
+				map(other.map),
+				leaf(other.leaf),
+				index(other.index)
+			{}
+
+			reference operator*() const
+			{
+				return reference(key(), value());
+			}
+			const K& key() const
+			{
+				if (leaf == nullptr)
+					throw out_of_bounds("Tried to dereference end iterator");
+				return leaf->keys[index];
+			}
+			mapped_reference value() const
+			{
+				if (leaf == nullptr)
+					throw out_of_bounds("Tried to dereference end iterator");
+				return leaf->vals[index];
+			}
+
+			basic_iterator& operator++()
+			{
+				if (leaf == nullptr)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				if (++index == leaf->count)
+				{
+					leaf = leaf->next;
+					index = 0;
+				}
+				return *this;
+			}
+			basic_iterator operator++(int)
+			{
+				basic_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			basic_iterator& operator--()
+			{
+				if (leaf == nullptr ? map->lastLeaf == nullptr : index == 0 && leaf->prev == nullptr)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				if (leaf == nullptr || index == 0)
+				{
+					leaf = leaf == nullptr ? map->lastLeaf : leaf->prev;
+					index = leaf->count;
+				}
+				index--;
+				return *this;
+			}
+			basic_iterator operator--(int)
+			{
+				basic_iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return leaf == other.leaf && index == other.index;
+			}
+			bool operator!=(const basic_iterator& other) const
+			{
+				return !(*this == other);
+			}
+		private:
+			void _validateCompare(const basic_iterator& other) const
+			{
+				if (map != other.map)
+					throw bad_iterator("Tried to compare iterators of different maps");
+			}
+		};
+	public:
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+	private:
+		Node* root;
+		Leaf* firstLeaf;
+		Leaf* lastLeaf;
+		size_t depth; //inner levels above the leaves
+		size_t v_size;
+		Comp comp;
+	public:
+		MyBTreeMap()
+			:
+			root(nullptr),
+			firstLeaf(nullptr),
+			lastLeaf(nullptr),
+			depth(0),
+			v_size(0)
+		{}
+		MyBTreeMap(std::initializer_list<value_type> list)
+			:
+			MyBTreeMap()
+		{
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				insert(it->first, it->second);
+		}
+		//builds the tree bottom up in O(n) from elements sorted by key
+		explicit MyBTreeMap(const MyVector<value_type>& sorted)
+			:
+			MyBTreeMap()
+		{
+			bulk_load(sorted);
+		}
+		MyBTreeMap(const MyBTreeMap& copy)
+			:
+			MyBTreeMap()
+		{
+			try
+			{
+				for (Leaf* leaf = copy.firstLeaf; leaf != nullptr; leaf = leaf->next)
+				{
+					for (size_t i = 0; i < leaf->count; i++)
+						_append(leaf->keys[i], leaf->vals[i]);
+				}
+				_buildInner();
+			}
+			catch (...)
+			{
+				_destroyLeaves();
+				throw;
+			}
+		}
+		MyBTreeMap(MyBTreeMap&& donor) noexcept
+			:
+			root(donor.root),
+			firstLeaf(donor.firstLeaf),
+			lastLeaf(donor.lastLeaf),
+			depth(donor.depth),
+			v_size(donor.v_size),
+			comp(donor.comp)
+		{
+			donor._reset();
+		}
+		~MyBTreeMap()
+		{
+			clear();
+		}
+
+		MyBTreeMap& operator=(const MyBTreeMap& copy)
+		{
+			if (this != &copy)
+			{
+				MyBTreeMap temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyBTreeMap& operator=(MyBTreeMap&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				clear();
+				swap(donor);
+			}
+			return *this;
+		}
+		void swap(MyBTreeMap& other) noexcept
+		{
+			std::swap(root, other.root);
+			std::swap(firstLeaf, other.firstLeaf);
+			std::swap(lastLeaf, other.lastLeaf);
+			std::swap(depth, other.depth);
+			std::swap(v_size, other.v_size);
+			std::swap(comp, other.comp);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		void clear()
+		{
+			if (root != nullptr)
+				_destroy(root, depth);
+			_reset();
+		}
+
+		//replaces the contents with a range sorted by key, of equal keys the first one is kept
+		template<typename Iter>
+		void bulk_load(Iter firstIt, Iter lastIt)
+		{
+			for (Iter previous = firstIt, it = firstIt; it != lastIt; previous = it)
+			{
+				if (++it != lastIt && comp(it->first, previous->first))
+					throw exception("bulk_load needs a range sorted by key");
+			}
+			clear();
+			try
+			{
+				for (; firstIt != lastIt; ++firstIt)
+				{
+					if (lastLeaf == nullptr || comp(lastLeaf->keys[lastLeaf->count - 1], firstIt->first))
+						_append(firstIt->first, firstIt->second);
+				}
+				_buildInner();
+			}
+			catch (...)
+			{
+				_destroyLeaves();
+				throw;
+			}
+		}
+		template<typename Range>
+		void bulk_load(const Range& range)
+		{
+			bulk_load(std::begin(range), std::end(range));
+		}
+		void bulk_load(const MyVector<value_type>& sorted)
+		{
+			bulk_load(sorted.getData(), sorted.getData() + sorted.size());
+		}
+
+		iterator begin()
+		{
+			return iterator(this, firstLeaf, 0);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, firstLeaf, 0);
+		}
+		iterator end()
+		{
+			return iterator(this, nullptr, 0);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, nullptr, 0);
+		}
+
+		//does nothing if the key is already in the map
+		template<typename... args>
+		std::pair<iterator, bool> try_emplace(const K& key, args&&... vals)
+		{
+			if (root == nullptr)
+			{
+				//the first leaf only becomes the root once the element is in it, so a throwing constructor leaves the map empty
+				Leaf* leaf = new Leaf;
+				try
+				{
+					_insertInLeaf(leaf, 0, key, V(std::forward<args>(vals)...));
+				}
+				catch (...)
+				{
+					delete leaf;
+					throw;
+				}
+				root = firstLeaf = lastLeaf = leaf;
+				v_size++;
+				return std::make_pair(iterator(this, leaf, 0), true);
+			}
+			Inner* path[maxDepth];
+			size_t slots[maxDepth];
+			Leaf* leaf = _descend(key, path, slots);
+			size_t index = _lowerIndex(leaf->keys, leaf->count, key);
+			if (index < leaf->count && !comp(key, leaf->keys[index]))
+				return std::make_pair(iterator(this, leaf, index), false);
+			V val(std::forward<args>(vals)...);
+			if (leaf->count < leafCapacity)
+			{
+				_insertInLeaf(leaf, index, key, std::move(val));
+				v_size++;
+				return std::make_pair(iterator(this, leaf, index), true);
+			}
+			iterator result = _splitInsert(leaf, index, key, std::move(val), path, slots);
+			v_size++;
+			return std::make_pair(result, true);
+		}
+		std::pair<iterator, bool> insert(const K& key, const V& val)
+		{
+			return try_emplace(key, val);
+		}
+		std::pair<iterator, bool> insert(const value_type& val)
+		{
+			return try_emplace(val.first, val.second);
+		}
+		std::pair<iterator, bool> insert_or_assign(const K& key, const V& val)
+		{
+			std::pair<iterator, bool> result = try_emplace(key, val);
+			if (!result.second)
+				result.first.value() = val;
+			return result;
+		}
+		V& operator[](const K& key)
+		{
+			return try_emplace(key).first.value();
+		}
+
+		V& at(const K& key)
+		{
+			iterator it = find(key);
+			if (it.leaf == nullptr)
+				throw out_of_bounds("Tried to access key that is not in the map");
+			return it.value();
+		}
+		const V& at(const K& key) const
+		{
+			return const_cast<MyBTreeMap*>(this)->at(key);
+		}
+		iterator find(const K& key)
+		{
+			iterator it = lower_bound(key);
+			if (it.leaf != nullptr && comp(key, it.key()))
+				return end();
+			return it;
+		}
+		const_iterator find(const K& key) const
+		{
+			return const_cast<MyBTreeMap*>(this)->find(key);
+		}
+		bool contains(const K& key) const
+		{
+			return find(key).leaf != nullptr;
+		}
+		size_t count(const K& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+		//first element whose key is not less than key
+		iterator lower_bound(const K& key)
+		{
+			if (root == nullptr)
+				return end();
+			Leaf* leaf = _findLeaf(key);
+			return _position(leaf, _lowerIndex(leaf->keys, leaf->count, key));
+		}
+		const_iterator lower_bound(const K& key) const
+		{
+			return const_cast<MyBTreeMap*>(this)->lower_bound(key);
+		}
+		//first element whose key is greater than key
+		iterator upper_bound(const K& key)
+		{
+			iterator it = lower_bound(key);
+			if (it.leaf != nullptr && !comp(key, it.key()))
+				++it;
+			return it;
+		}
+		const_iterator upper_bound(const K& key) const
+		{
+			return const_cast<MyBTreeMap*>(this)->upper_bound(key);
+		}
+
+		//calls func(key, value) for every element in order, walking the leaf arrays directly
+		template<typename Func>
+		void forEach(Func func) const
+		{
+			for (const Leaf* leaf = firstLeaf; leaf != nullptr; leaf = leaf->next)
+			{
+				for (size_t i = 0; i < leaf->count; i++)
+					func(leaf->keys[i], leaf->vals[i]);
+			}
+		}
+		//calls func(key, value) for the elements with keys in [lo, hi)
+		template<typename Func>
+		void forEachInRange(const K& lo, const K& hi, Func func) const
+		{
+			if (root == nullptr || !comp(lo, hi))
+				return;
+			const Leaf* leaf = _findLeaf(lo);
+			size_t i = _lowerIndex(leaf->keys, leaf->count, lo);
+			for (; leaf != nullptr; leaf = leaf->next, i = 0)
+			{
+				//only the last leaf of the range needs the upper bound checked per key
+				if (!comp(leaf->keys[leaf->count - 1], hi))
+				{
+					for (; i < leaf->count && comp(leaf->keys[i], hi); i++)
+						func(leaf->keys[i], leaf->vals[i]);
+					return;
+				}
+				for (; i < leaf->count; i++)
+					func(leaf->keys[i], leaf->vals[i]);
+			}
+		}
+
+		size_t erase(const K& key)
+		{
+			if (root == nullptr)
+				return 0;
+			Inner* path[maxDepth];
+			size_t slots[maxDepth];
+			Leaf* leaf = _descend(key, path, slots);
+			size_t index = _lowerIndex(leaf->keys, leaf->count, key);
+			if (index == leaf->count || comp(key, leaf->keys[index]))
+				return 0;
+			_eraseAt(leaf, index, path, slots);
+			return 1;
+		}
+		//returns the iterator to the element after the erased one
+		iterator erase(const_iterator position)
+		{
+			if (position.map != this)
+				throw bad_iterator("Tried to pass iterator from different map");
+			if (position.leaf == nullptr)
+				throw out_of_bounds("Tried to erase end iterator");
+			const_iterator next = position;
+			++next;
+			if (next.leaf == nullptr)
+			{
+				erase(position.key());
+				return end();
+			}
+			//rebalancing may move the following element, so it is looked up again by key
+			K nextKey = next.key();
+			erase(position.key());
+			return find(nextKey);
+		}
+	private:
+		size_t _lowerIndex(const K* keys, size_t count, const K& key) const
+		{
+			if constexpr (simdSearch)
+				return FlatSearch::countLess(keys, count, key);
+			else
+				return FlatSearch::lowerBound(keys, count, key, comp);
+		}
+		//child of inner whose range contains key
+		size_t _childIndex(const Inner* inner, const K& key) const
+		{
+			size_t index = _lowerIndex(inner->keys, inner->count, key);
+			if (index < inner->count && !comp(key, inner->keys[index]))
+				index++;
+			return index;
+		}
+		Leaf* _findLeaf(const K& key) const
+		{
+			Node* node = root;
+			for (size_t level = 0; level < depth; level++)
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				node = inner->children[_childIndex(inner, key)];
+			}
+			return static_cast<Leaf*>(node);
+		}
+		//like _findLeaf, remembering the inner nodes on the way and which child was taken in each
+		Leaf* _descend(const K& key, Inner** path, size_t* slots) const
+		{
+			Node* node = root;
+			for (size_t level = 0; level < depth; level++)
+			{
+				Inner* inner = static_cast<Inner*>(node);
+				path[level] = inner;
+				slots[level] = _childIndex(inner, key);
+				node = inner->children[slots[level]];
+			}
+			return static_cast<Leaf*>(node);
+		}
+		iterator _position(Leaf* leaf, size_t index)
+		{
+			if (index == leaf->count)
+				return iterator(this, leaf->next, 0);
+			return iterator(this, leaf, index);
+		}
+
+		static void _insertInLeaf(Leaf* leaf, size_t index, const K& key, V&& val)
+		{
+			std::move_backward(leaf->keys + index, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+			std::move_backward(leaf->vals + index, leaf->vals + leaf->count, leaf->vals + leaf->count + 1);
+			leaf->keys[index] = key;
+			leaf->vals[index] = std::move(val);
+			leaf->count++;
+		}
+		//the leaf is full, it and every full inner node above it are split in half.
+		//all new nodes are allocated first so a failed allocation leaves the tree untouched
+		iterator _splitInsert(Leaf* leaf, size_t index, const K& key, V&& val, Inner** path, size_t* slots)
+		{
+			size_t level = depth;
+			while (level > 0 && path[level - 1]->count == innerCapacity)
+				level--;
+			size_t newInners = depth - level + (level == 0 ? 1 : 0);
+			Leaf* right = new Leaf;
+			Inner* spare[maxDepth + 1];
+			size_t allocated = 0;
+			try
+			{
+				for (; allocated < newInners; allocated++)
+					spare[allocated] = new Inner;
+			}
+			catch (...)
+			{
+				while (allocated > 0)
+					delete spare[--allocated];
+				delete right;
+				throw;
+			}
+
+			//appending to the last leaf keeps it full and starts a new one, so ascending inserts fill every leaf
+			size_t keep = leaf == lastLeaf && index == leafCapacity ? leafCapacity : leafCapacity / 2;
+			std::move(leaf->keys + keep, leaf->keys + leafCapacity, right->keys);
+			std::move(leaf->vals + keep, leaf->vals + leafCapacity, right->vals);
+			right->count = leafCapacity - keep;
+			leaf->count = keep;
+			right->prev = leaf;
+			right->next = leaf->next;
+			if (leaf->next != nullptr)
+				leaf->next->prev = right;
+			else
+				lastLeaf = right;
+			leaf->next = right;
+			iterator result(this, nullptr, 0);
+			if (index > keep || keep == leafCapacity)
+			{
+				_insertInLeaf(right, index - keep, key, std::move(val));
+				result = iterator(this, right, index - keep);
+			}
+			else
+			{
+				_insertInLeaf(leaf, index, key, std::move(val));
+				result = iterator(this, leaf, index);
+			}
+
+			//hand the first key of each new right half to the parent
+			K separator = right->keys[0];
+			Node* child = right;
+			for (level = depth; ; level--)
+			{
+				if (level == 0)
+				{
+					Inner* newRoot = spare[--allocated];
+					newRoot->keys[0] = std::move(separator);
+					newRoot->children[0] = root;
+					newRoot->children[1] = child;
+					newRoot->count = 1;
+					root = newRoot;
+					depth++;
+					break;
+				}
+				Inner* parent = path[level - 1];
+				size_t slot = slots[level - 1];
+				if (parent->count < innerCapacity)
+				{
+					std::move_backward(parent->keys + slot, parent->keys + parent->count, parent->keys + parent->count + 1);
+					std::move_backward(parent->children + slot + 1, parent->children + parent->count + 1, parent->children + parent->count + 2);
+					parent->keys[slot] = std::move(separator);
+					parent->children[slot + 1] = child;
+					parent->count++;
+					break;
+				}
+				//the middle of the keys including the new one moves up, the upper half goes to a new node
+				Inner* sibling = spare[--allocated];
+				K keys[innerCapacity + 1];
+				Node* children[innerCapacity + 2];
+				std::move(parent->keys, parent->keys + slot, keys);
+				keys[slot] = std::move(separator);
+				std::move(parent->keys + slot, parent->keys + innerCapacity, keys + slot + 1);
+				std::copy(parent->children, parent->children + slot + 1, children);
+				children[slot + 1] = child;
+				std::copy(parent->children + slot + 1, parent->children + innerCapacity + 1, children + slot + 2);
+				size_t middle = (innerCapacity + 1) / 2;
+				std::move(keys, keys + middle, parent->keys);
+				std::copy(children, children + middle + 1, parent->children);
+				parent->count = middle;
+				std::move(keys + middle + 1, keys + innerCapacity + 1, sibling->keys);
+				std::copy(children + middle + 1, children + innerCapacity + 2, sibling->children);
+				sibling->count = innerCapacity - middle;
+				separator = std::move(keys[middle]);
+				child = sibling;
+			}
+			return result;
+		}
+
+		//removes the element and merges or refills nodes that dropped below half full on the way up
+		void _eraseAt(Leaf* leaf, size_t index, Inner** path, size_t* slots)
+		{
+			std::move(leaf->keys + index + 1, leaf->keys + leaf->count, leaf->keys + index);
+			std::move(leaf->vals + index + 1, leaf->vals + leaf->count, leaf->vals + index);
+			leaf->count--;
+			//the abandoned slot should not keep resources alive
+			leaf->keys[leaf->count] = K();
+			leaf->vals[leaf->count] = V();
+			v_size--;
+			if (depth == 0)
+			{
+				if (leaf->count == 0)
+				{
+					delete leaf;
+					_reset();
+				}
+				return;
+			}
+			if (leaf->count >= minLeaf)
+				return;
+
+			Inner* parent = path[depth - 1];
+			size_t slot = slots[depth - 1];
+			size_t separator = slot > 0 ? slot - 1 : 0;
+			Leaf* left = static_cast<Leaf*>(parent->children[separator]);
+			Leaf* right = static_cast<Leaf*>(parent->children[separator + 1]);
+			if (left->count + right->count <= leafCapacity)
+			{
+				std::move(right->keys, right->keys + right->count, left->keys + left->count);
+				std::move(right->vals, right->vals + right->count, left->vals + left->count);
+				left->count += right->count;
+				left->next = right->next;
+				if (right->next != nullptr)
+					right->next->prev = left;
+				else
+					lastLeaf = left;
+				delete right;
+				_removeChild(parent, separator);
+				_rebalanceInner(path, slots);
+				return;
+			}
+			if (left == leaf)
+			{
+				_insertInLeaf(left, left->count, right->keys[0], std::move(right->vals[0]));
+				std::move(right->keys + 1, right->keys + right->count, right->keys);
+				std::move(right->vals + 1, right->vals + right->count, right->vals);
+				right->count--;
+				right->keys[right->count] = K();
+				right->vals[right->count] = V();
+			}
+			else
+			{
+				left->count--;
+				_insertInLeaf(right, 0, left->keys[left->count], std::move(left->vals[left->count]));
+				left->keys[left->count] = K();
+				left->vals[left->count] = V();
+			}
+			parent->keys[separator] = right->keys[0];
+		}
+		//drops keys[separator] and the child right of it
+		static void _removeChild(Inner* inner, size_t separator)
+		{
+			std::move(inner->keys + separator + 1, inner->keys + inner->count, inner->keys + separator);
+			std::move(inner->children + separator + 2, inner->children + inner->count + 1, inner->children + separator + 1);
+			inner->count--;
+			inner->keys[inner->count] = K();
+		}
+		void _rebalanceInner(Inner** path, size_t* slots)
+		{
+			for (size_t level = depth - 1; ; level--)
+			{
+				Inner* node = path[level];
+				if (level == 0)
+				{
+					//a root with a single child is replaced by that child
+					if (node->count == 0)
+					{
+						root = node->children[0];
+						delete node;
+						depth--;
+					}
+					return;
+				}
+				if (node->count >= minInner)
+					return;
+				Inner* parent = path[level - 1];
+				size_t slot = slots[level - 1];
+				size_t separator = slot > 0 ? slot - 1 : 0;
+				Inner* left = static_cast<Inner*>(parent->children[separator]);
+				Inner* right = static_cast<Inner*>(parent->children[separator + 1]);
+				if (left->count + right->count + 1 <= innerCapacity)
+				{
+					//the separator comes down between the keys of both nodes
+					left->keys[left->count] = std::move(parent->keys[separator]);
+					std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+					std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+					left->count += right->count + 1;
+					delete right;
+					_removeChild(parent, separator);
+					continue;
+				}
+				//rotate one child through the parent
+				if (left == node)
+				{
+					left->keys[left->count] = std::move(parent->keys[separator]);
+					left->children[left->count + 1] = right->children[0];
+					left->count++;
+					parent->keys[separator] = std::move(right->keys[0]);
+					std::move(right->keys + 1, right->keys + right->count, right->keys);
+					std::copy(right->children + 1, right->children + right->count + 1, right->children);
+					right->count--;
+					right->keys[right->count] = K();
+				}
+				else
+				{
+					std::move_backward(right->keys, right->keys + right->count, right->keys + right->count + 1);
+					std::copy_backward(right->children, right->children + right->count + 1, right->children + right->count + 2);
+					right->keys[0] = std::move(parent->keys[separator]);
+					right->children[0] = left->children[left->count];
+					right->count++;
+					left->count--;
+					parent->keys[separator] = std::move(left->keys[left->count]);
+					left->keys[left->count] = K();
+				}
+				return;
+			}
+		}
+
+		//fills leaves completely from the left, _buildInner puts the tree on top afterwards
+		void _append(const K& key, const V& val)
+		{
+			if (lastLeaf == nullptr || lastLeaf->count == leafCapacity)
+			{
+				Leaf* leaf = new Leaf;
+				leaf->prev = lastLeaf;
+				if (lastLeaf != nullptr)
+					lastLeaf->next = leaf;
+				else
+					firstLeaf = leaf;
+				lastLeaf = leaf;
+			}
+			lastLeaf->keys[lastLeaf->count] = key;
+			lastLeaf->vals[lastLeaf->count] = val;
+			lastLeaf->count++;
+			v_size++;
+		}
+		void _buildInner()
+		{
+			if (firstLeaf == nullptr)
+				return;
+			//the last leaf takes elements from the one before it so both are at least half full
+			Leaf* last = lastLeaf;
+			if (last->prev != nullptr && last->count < minLeaf)
+			{
+				Leaf* previous = last->prev;
+				size_t moving = (previous->count + last->count) / 2 - last->count;
+				std::move_backward(last->keys, last->keys + last->count, last->keys + last->count + moving);
+				std::move_backward(last->vals, last->vals + last->count, last->vals + last->count + moving);
+				std::move(previous->keys + previous->count - moving, previous->keys + previous->count, last->keys);
+				std::move(previous->vals + previous->count - moving, previous->vals + previous->count, last->vals);
+				previous->count -= moving;
+				last->count += moving;
+			}
+			MyVector<Node*> nodes;
+			MyVector<K> lowest; //smallest key below each node
+			for (Leaf* leaf = firstLeaf; leaf != nullptr; leaf = leaf->next)
+			{
+				nodes.push_back(leaf);
+				lowest.push_back(leaf->keys[0]);
+			}
+			//there are fewer inner nodes than leaves, so remembering them never reallocates
+			MyVector<Inner*> built;
+			built.reserve(nodes.size());
+			try
+			{
+				//each level spreads its nodes evenly over as few parents as possible, written over the front of the same vectors
+				while (nodes.size() > 1)
+				{
+					size_t children = nodes.size();
+					size_t parents = (children + innerCapacity) / (innerCapacity + 1);
+					size_t next = 0;
+					for (size_t i = 0; i < parents; i++)
+					{
+						size_t taking = children / parents + (i < children % parents ? 1 : 0);
+						Inner* inner = new Inner;
+						built.push_back(inner);
+						for (size_t j = 0; j < taking; j++)
+						{
+							inner->children[j] = nodes[next + j];
+							if (j > 0)
+								inner->keys[j - 1] = lowest[next + j];
+						}
+						inner->count = taking - 1;
+						nodes[i] = inner;
+						lowest[i] = lowest[next];
+						next += taking;
+					}
+					nodes.resize(parents);
+					lowest.resize(parents);
+					depth++;
+				}
+			}
+			catch (...)
+			{
+				for (size_t i = 0; i < built.size(); i++)
+					delete built[i];
+				depth = 0;
+				throw;
+			}
+			root = nodes[0];
+		}
+
+		static void _destroy(Node* node, size_t level)
+		{
+			if (level == 0)
+			{
+				delete static_cast<Leaf*>(node);
+				return;
+			}
+			Inner* inner = static_cast<Inner*>(node);
+			for (size_t i = 0; i <= inner->count; i++)
+				_destroy(inner->children[i], level - 1);
+			delete inner;
+		}
+		//for a failed bulk load, when the leaves are complete but not every inner node is
+		void _destroyLeaves()
+		{
+			for (Leaf* leaf = firstLeaf; leaf != nullptr;)
+			{
+				Leaf* next = leaf->next;
+				delete leaf;
+				leaf = next;
+			}
+			_reset();
+		}
+		void _reset()
+		{
+			root = nullptr;
+			firstLeaf = lastLeaf = nullptr;
+			depth = 0;
+			v_size = 0;
+		}
+	};
+}
\ No newline at end of file
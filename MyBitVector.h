@@ -0,0 +1,631 @@
+#pragma once
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "MyVector.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MYSTL_BITVECTOR_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#define MYSTL_BITVECTOR_AVX2
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MySTL
+{
+	//packed bits in 64 bit words, the bits past the size in the last word are always zero.
+	//counting uses popcount per word, searches skip whole zero words and take the lowest bit with a trailing zero count.
+	//rank and select scan the words unless build_rank_index() stored the number of ones before every 512 bits,
+	//which costs 1.6% extra memory and holds until the next change
+	class MyBitVector
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("BitVector exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		//a single bit that can be assigned through
+		class reference
+		{
+		private:
+			friend class MyBitVector;
+
+			MyBitVector* vec;
+			size_t index;
+
+			reference(MyBitVector* vec, size_t index)
+				:
+				vec(vec),
+				index(index)
+			{}
+		public:
+			operator bool() const
+			{
+				return vec->test(index);
+			}
+			reference& operator=(bool val)
+			{
+				vec->set(index, val);
+				return *this;
+			}
+			reference& operator=(const reference& other)
+			{
+				return *this = bool(other);
+			}
+			void flip()
+			{
+				vec->flip(index);
+			}
+		};
+
+		static constexpr size_t npos = size_t(-1);
+	private:
+		static constexpr size_t wordBits = 64;
+		static constexpr size_t blockWords = 8; //words per entry of the rank index
+
+		enum class Op { And, Or, Xor, AndNot };
+
+		uint64_t* words;
+		size_t v_size; //bits
+		size_t v_capacity; //words
+		MyVector<uint64_t> rankBlocks; //ones before each block of blockWords words, and the total at the end
+		bool rankValid;
+	public:
+		MyBitVector()
+			:
+			words(nullptr),
+			v_size(0),
+			v_capacity(0),
+			rankValid(false)
+		{}
+		MyBitVector(size_t v_size, bool val = false)
+			:
+			words(nullptr),
+			v_size(0),
+			v_capacity(0),
+			rankValid(false)
+		{
+			resize(v_size, val);
+		}
+		explicit MyBitVector(const MyVector<bool>& flags)
+			:
+			MyBitVector(flags.size())
+		{
+			const bool* data = flags.getData();
+			for (size_t i = 0; i < v_size; i++)
+				words[i / wordBits] |= uint64_t(data[i]) << (i % wordBits);
+		}
+		MyBitVector(const MyBitVector& copy)
+			:
+			words(nullptr),
+			v_size(copy.v_size),
+			v_capacity(copy._wordCount()),
+			rankBlocks(copy.rankBlocks),
+			rankValid(copy.rankValid)
+		{
+			words = new uint64_t[v_capacity];
+			std::copy(copy.words, copy.words + v_capacity, words);
+		}
+		MyBitVector(MyBitVector&& donor) noexcept
+			:
+			words(donor.words),
+			v_size(donor.v_size),
+			v_capacity(donor.v_capacity),
+			rankBlocks(std::move(donor.rankBlocks)),
+			rankValid(donor.rankValid)
+		{
+			donor.words = nullptr;
+			donor.v_size = 0;
+			donor.v_capacity = 0;
+			donor.rankValid = false;
+		}
+		~MyBitVector()
+		{
+			delete[] words;
+		}
+
+		MyBitVector& operator=(const MyBitVector& copy)
+		{
+			if (this != &copy)
+			{
+				MyBitVector temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyBitVector& operator=(MyBitVector&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				MyBitVector temp(std::move(donor));
+				swap(temp);
+			}
+			return *this;
+		}
+		void swap(MyBitVector& other) noexcept
+		{
+			std::swap(words, other.words);
+			std::swap(v_size, other.v_size);
+			std::swap(v_capacity, other.v_capacity);
+			rankBlocks.swap(other.rankBlocks);
+			std::swap(rankValid, other.rankValid);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		//in bits
+		size_t capacity() const
+		{
+			return v_capacity * wordBits;
+		}
+		size_t word_count() const
+		{
+			return _wordCount();
+		}
+		uint64_t* getData()
+		{
+			rankValid = false;
+			return words;
+		}
+		const uint64_t* getData() const
+		{
+			return words;
+		}
+
+		void reserve(size_t bits)
+		{
+			size_t needed = (bits + wordBits - 1) / wordBits;
+			if (needed > v_capacity)
+				_reallocate(needed);
+		}
+		void resize(size_t bits, bool val = false)
+		{
+			rankValid = false;
+			if (bits < v_size)
+			{
+				v_size = bits;
+				_clearTail();
+				return;
+			}
+			reserve(bits);
+			size_t oldWords = _wordCount();
+			size_t newWords = (bits + wordBits - 1) / wordBits;
+			if (val && v_size % wordBits != 0)
+				words[oldWords - 1] |= ~uint64_t(0) << (v_size % wordBits);
+			std::fill(words + oldWords, words + newWords, val ? ~uint64_t(0) : 0);
+			v_size = bits;
+			_clearTail();
+		}
+		void clear()
+		{
+			v_size = 0;
+			rankValid = false;
+		}
+		void push_back(bool val)
+		{
+			if (v_size == v_capacity * wordBits)
+				_reallocate(v_capacity == 0 ? 1 : v_capacity * 2);
+			if (v_size % wordBits == 0)
+				words[v_size / wordBits] = 0;
+			words[v_size / wordBits] |= uint64_t(val) << (v_size % wordBits);
+			v_size++;
+			rankValid = false;
+		}
+		void pop_back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to pop from empty bit vector");
+			v_size--;
+			words[v_size / wordBits] &= ~(uint64_t(1) << (v_size % wordBits));
+			rankValid = false;
+		}
+
+		bool test(size_t index) const
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return (words[index / wordBits] >> (index % wordBits)) & 1;
+		}
+		bool operator[](size_t index) const
+		{
+			return test(index);
+		}
+		reference operator[](size_t index)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return reference(this, index);
+		}
+		void set(size_t index, bool val = true)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			uint64_t mask = uint64_t(1) << (index % wordBits);
+			uint64_t& word = words[index / wordBits];
+			word = val ? word | mask : word & ~mask;
+			rankValid = false;
+		}
+		void reset(size_t index)
+		{
+			set(index, false);
+		}
+		void flip(size_t index)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			words[index / wordBits] ^= uint64_t(1) << (index % wordBits);
+			rankValid = false;
+		}
+		//the whole vector at once
+		void set()
+		{
+			std::fill(words, words + _wordCount(), ~uint64_t(0));
+			_clearTail();
+			rankValid = false;
+		}
+		void reset()
+		{
+			std::fill(words, words + _wordCount(), uint64_t(0));
+			rankValid = false;
+		}
+		void flip()
+		{
+			for (size_t i = 0, count = _wordCount(); i < count; i++)
+				words[i] = ~words[i];
+			_clearTail();
+			rankValid = false;
+		}
+
+		//number of set bits
+		size_t count() const
+		{
+			size_t result = 0;
+			for (size_t i = 0, count = _wordCount(); i < count; i++)
+				result += _popcount(words[i]);
+			return result;
+		}
+		size_t count(bool val) const
+		{
+			return val ? count() : v_size - count();
+		}
+		bool any() const
+		{
+			for (size_t i = 0, count = _wordCount(); i < count; i++)
+			{
+				if (words[i] != 0)
+					return true;
+			}
+			return false;
+		}
+		bool none() const
+		{
+			return !any();
+		}
+		bool all() const
+		{
+			return count() == v_size;
+		}
+
+		//both vectors need the same size
+		MyBitVector& operator&=(const MyBitVector& other)
+		{
+			_combine<Op::And>(other);
+			return *this;
+		}
+		MyBitVector& operator|=(const MyBitVector& other)
+		{
+			_combine<Op::Or>(other);
+			return *this;
+		}
+		MyBitVector& operator^=(const MyBitVector& other)
+		{
+			_combine<Op::Xor>(other);
+			return *this;
+		}
+		//clears the bits that are set in other
+		MyBitVector& and_not(const MyBitVector& other)
+		{
+			_combine<Op::AndNot>(other);
+			return *this;
+		}
+		MyBitVector operator&(const MyBitVector& other) const
+		{
+			MyBitVector result(*this);
+			return result &= other;
+		}
+		MyBitVector operator|(const MyBitVector& other) const
+		{
+			MyBitVector result(*this);
+			return result |= other;
+		}
+		MyBitVector operator^(const MyBitVector& other) const
+		{
+			MyBitVector result(*this);
+			return result ^= other;
+		}
+		MyBitVector operator~() const
+		{
+			MyBitVector result(*this);
+			result.flip();
+			return result;
+		}
+		bool operator==(const MyBitVector& other) const
+		{
+			return v_size == other.v_size && std::equal(words, words + _wordCount(), other.words);
+		}
+		bool operator!=(const MyBitVector& other) const
+		{
+			return !(*this == other);
+		}
+
+		//position of the first set bit, or npos
+		size_t find_first() const
+		{
+			return _findFrom(0);
+		}
+		//position of the first set bit after index, or npos
+		size_t find_next(size_t index) const
+		{
+			if (index >= v_size)
+				return npos;
+			return _findFrom(index + 1);
+		}
+		//calls func(index) for every set bit in ascending order
+		template<typename Func>
+		void forEachSet(Func func) const
+		{
+			for (size_t i = 0, count = _wordCount(); i < count; i++)
+			{
+				for (uint64_t word = words[i]; word != 0; word &= word - 1)
+					func(i * wordBits + _trailingZeros(word));
+			}
+		}
+
+		//stores the number of ones before every block so rank takes constant time and select a binary search
+		void build_rank_index()
+		{
+			size_t wordCount = _wordCount();
+			size_t blocks = (wordCount + blockWords - 1) / blockWords;
+			MyVector<uint64_t> built;
+			built.reserve(blocks + 1);
+			uint64_t ones = 0;
+			for (size_t block = 0; block < blocks; block++)
+			{
+				built.push_back(ones);
+				for (size_t i = block * blockWords, stop = std::min(i + blockWords, wordCount); i < stop; i++)
+					ones += _popcount(words[i]);
+			}
+			built.push_back(ones);
+			rankBlocks = std::move(built);
+			rankValid = true;
+		}
+		//number of set bits before index
+		size_t rank(size_t index) const
+		{
+			if (index > v_size)
+				throw out_of_bounds("Tried to rank position out of bounds");
+			size_t word = index / wordBits;
+			size_t result = 0;
+			size_t i = 0;
+			if (rankValid)
+			{
+				result = size_t(rankBlocks.getData()[word / blockWords]);
+				i = word / blockWords * blockWords;
+			}
+			for (; i < word; i++)
+				result += _popcount(words[i]);
+			if (index % wordBits != 0)
+				result += _popcount(words[word] & ((uint64_t(1) << (index % wordBits)) - 1));
+			return result;
+		}
+		//position of the set bit with rank n, the first one has rank 0, or npos if there are not that many
+		size_t select(size_t n) const
+		{
+			size_t wordCount = _wordCount();
+			size_t i = 0;
+			if (rankValid)
+			{
+				const uint64_t* blocks = rankBlocks.getData();
+				size_t blockCount = rankBlocks.size() - 1;
+				if (n >= blocks[blockCount])
+					return npos;
+				//last block that starts with at most n ones before it
+				size_t block = size_t(std::upper_bound(blocks, blocks + blockCount, uint64_t(n)) - blocks) - 1;
+				n -= size_t(blocks[block]);
+				i = block * blockWords;
+			}
+			for (; i < wordCount; i++)
+			{
+				size_t ones = _popcount(words[i]);
+				if (n < ones)
+				{
+					uint64_t word = words[i];
+					for (; n > 0; n--)
+						word &= word - 1;
+					return i * wordBits + _trailingZeros(word);
+				}
+				n -= ones;
+			}
+			return npos;
+		}
+
+		MyVector<bool> toVector() const
+		{
+			MyVector<bool> result;
+			result.reserve(v_size);
+			for (size_t i = 0; i < v_size; i++)
+				result.push_back((words[i / wordBits] >> (i % wordBits)) & 1);
+			return result;
+		}
+	private:
+		size_t _wordCount() const
+		{
+			return (v_size + wordBits - 1) / wordBits;
+		}
+		//zeroes the bits past the size in the last word
+		void _clearTail()
+		{
+			if (v_size % wordBits != 0)
+				words[v_size / wordBits] &= (uint64_t(1) << (v_size % wordBits)) - 1;
+		}
+		void _reallocate(size_t newCapacity)
+		{
+			uint64_t* newWords = new uint64_t[newCapacity];
+			std::copy(words, words + _wordCount(), newWords);
+			delete[] words;
+			words = newWords;
+			v_capacity = newCapacity;
+		}
+		size_t _findFrom(size_t index) const
+		{
+			if (index >= v_size)
+				return npos;
+			size_t i = index / wordBits;
+			uint64_t word = words[i] & (~uint64_t(0) << (index % wordBits));
+			for (size_t count = _wordCount(); word == 0;)
+			{
+				if (++i == count)
+					return npos;
+				word = words[i];
+			}
+			return i * wordBits + _trailingZeros(word);
+		}
+
+		template<Op op>
+		void _combine(const MyBitVector& other)
+		{
+			if (other.v_size != v_size)
+				throw exception("Tried to combine bit vectors of different sizes");
+			uint64_t* target = words;
+			const uint64_t* source = other.words;
+			size_t count = _wordCount();
+			size_t i = 0;
+#ifdef MYSTL_BITVECTOR_AVX2
+			for (; i + 4 <= count; i += 4)
+			{
+				__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i));
+				__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _apply<op>(a, b));
+			}
+#endif
+#ifdef MYSTL_BITVECTOR_SSE2
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(target + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), _apply<op>(a, b));
+			}
+#endif
+			for (; i < count; i++)
+				target[i] = _apply<op>(target[i], source[i]);
+			rankValid = false;
+		}
+		template<Op op>
+		static uint64_t _apply(uint64_t a, uint64_t b)
+		{
+			if constexpr (op == Op::And)
+				return a & b;
+			else if constexpr (op == Op::Or)
+				return a | b;
+			else if constexpr (op == Op::Xor)
+				return a ^ b;
+			else
+				return a & ~b;
+		}
+#ifdef MYSTL_BITVECTOR_SSE2
+		template<Op op>
+		static __m128i _apply(__m128i a, __m128i b)
+		{
+			if constexpr (op == Op::And)
+				return _mm_and_si128(a, b);
+			else if constexpr (op == Op::Or)
+				return _mm_or_si128(a, b);
+			else if constexpr (op == Op::Xor)
+				return _mm_xor_si128(a, b);
+			else
+				return _mm_andnot_si128(b, a);
+		}
+#endif
+#ifdef MYSTL_BITVECTOR_AVX2
+		template<Op op>
+		static __m256i _apply(__m256i a, __m256i b)
+		{
+			if constexpr (op == Op::And)
+				return _mm256_and_si256(a, b);
+			else if constexpr (op == Op::Or)
+				return _mm256_or_si256(a, b);
+			else if constexpr (op == Op::Xor)
+				return _mm256_xor_si256(a, b);
+			else
+				return _mm256_andnot_si256(b, a);
+		}
+#endif
+
+		static size_t _popcount(uint64_t word)
+		{
+#ifdef _MSC_VER
+#ifdef _WIN64
+			return size_t(__popcnt64(word));
+#else
+			return size_t(__popcnt(uint32_t(word)) + __popcnt(uint32_t(word >> 32)));
+#endif
+#else
+			return size_t(__builtin_popcountll(word));
+#endif
+		}
+		//word must not be zero
+		static size_t _trailingZeros(uint64_t word)
+		{
+#ifdef _MSC_VER
+			unsigned long bit;
+#ifdef _WIN64
+			_BitScanForward64(&bit, word);
+#else
+			if (!_BitScanForward(&bit, uint32_t(word)))
+			{
+				_BitScanForward(&bit, uint32_t(word >> 32));
+				bit += 32;
+			}
+#endif
+			return bit;
+#else
+			return size_t(__builtin_ctzll(word));
+#endif
+		}
+	};
+}
\ No newline at end of file
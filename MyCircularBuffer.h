@@ -0,0 +1,479 @@
+#pragma once
+
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "MyVector.h"
+#include "MySpan.h"
+
+namespace MySTL
+{
+	//ring of a fixed number of elements in one MyVector, pushing and popping at either end never moves elements.
+	//a full buffer either throws on the next push or, in overwrite mode, drops the element at the opposite end.
+	//the elements are in storage order from head, wrapping to the start of the vector once,
+	//spans() hands out both parts and linearize() rotates them into one
+	template<typename T>
+	class MyCircularBuffer
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("CircularBuffer exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+	private:
+		//random access in logical order, oldest element first
+		template<bool IsConst>
+		class basic_iterator
+		{
+		public:
+			using buffer_type = typename std::conditional<IsConst, const MyCircularBuffer, MyCircularBuffer>::type;
+			using value_type = T;
+			using reference = typename std::conditional<IsConst, const T&, T&>::type;
+			using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+		private:
+			friend class MyCircularBuffer;
+			template<bool> friend class basic_iterator;
+
+			buffer_type* buffer;
+			size_t index;
+
+			basic_iterator(buffer_type* buffer, size_t index)
+				:
+				buffer(buffer),
+				index(index)
+			{}
+		public:
+			basic_iterator()
+				:
+				buffer(nullptr),
+				index(0)
+			{}
+			//a mutable iterator converts to a const one
+			template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+			basic_iterator(const basic_iterator<WasConst>& other)
+				:
+				buffer(other.buffer),
+				index(other.index)
+			{}
+
+			reference operator*() const
+			{
+				return (*buffer)[index];
+			}
+			pointer operator->() const
+			{
+				return &(*buffer)[index];
+			}
+			reference operator[](difference_type n) const
+			{
+				return (*buffer)[index + n];
+			}
+
+			basic_iterator& operator++()
+			{
+				if (++index > buffer->v_size)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				return *this;
+			}
+			basic_iterator operator++(int)
+			{
+				basic_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			basic_iterator& operator--()
+			{
+				if (index-- == 0)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				return *this;
+			}
+			basic_iterator operator--(int)
+			{
+				basic_iterator result(*this);
+				--(*this);
+				return result;
+			}
+			basic_iterator& operator+=(difference_type n)
+			{
+				if (n > 0 ? index + n > buffer->v_size : size_t(-n) > index)
+					throw out_of_bounds("Tried to move iterator out of bounds");
+				index += n;
+				return *this;
+			}
+			basic_iterator& operator-=(difference_type n)
+			{
+				return *this += -n;
+			}
+			basic_iterator operator+(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result += n;
+			}
+			friend basic_iterator operator+(difference_type n, const basic_iterator& it)
+			{
+				return it + n;
+			}
+			basic_iterator operator-(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result -= n;
+			}
+			difference_type operator-(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return difference_type(index) - difference_type(other.index);
+			}
+
+			bool operator==(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index == other.index;
+			}
+			bool operator!=(const basic_iterator& other) const
+			{
+				return !(*this == other);
+			}
+			bool operator<(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index < other.index;
+			}
+			bool operator>(const basic_iterator& other) const
+			{
+				return other < *this;
+			}
+			bool operator<=(const basic_iterator& other) const
+			{
+				return !(other < *this);
+			}
+			bool operator>=(const basic_iterator& other) const
+			{
+				return !(*this < other);
+			}
+		private:
+			void _validateCompare(const basic_iterator& other) const
+			{
+				if (buffer != other.buffer)
+					throw bad_iterator("Tried to compare iterators of different buffers");
+			}
+		};
+	public:
+		using value_type = T;
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+	private:
+		MyVector<T> storage; //always holds capacity elements, the free slots are default constructed
+		size_t head; //slot of the oldest element
+		size_t v_size;
+		bool overwrite;
+	public:
+		explicit MyCircularBuffer(size_t capacity, bool overwrite = false)
+			:
+			head(0),
+			v_size(0),
+			overwrite(overwrite)
+		{
+			if (capacity == 0)
+				throw exception("Tried to create circular buffer without capacity");
+			storage.reserve(capacity);
+			storage.resize(capacity);
+		}
+		MyCircularBuffer(const MyCircularBuffer& copy) = default;
+		MyCircularBuffer(MyCircularBuffer&& donor) noexcept
+			:
+			storage(std::move(donor.storage)),
+			head(donor.head),
+			v_size(donor.v_size),
+			overwrite(donor.overwrite)
+		{
+			//a moved from MyVector keeps its size
+			donor.storage = MyVector<T>();
+			donor.head = 0;
+			donor.v_size = 0;
+		}
+		MyCircularBuffer& operator=(const MyCircularBuffer& copy) = default;
+		MyCircularBuffer& operator=(MyCircularBuffer&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				storage = std::move(donor.storage);
+				head = donor.head;
+				v_size = donor.v_size;
+				overwrite = donor.overwrite;
+				donor.storage = MyVector<T>();
+				donor.head = 0;
+				donor.v_size = 0;
+			}
+			return *this;
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		size_t capacity() const
+		{
+			return storage.size();
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		bool full() const
+		{
+			return v_size == storage.size();
+		}
+		//whether pushing into a full buffer drops the element at the other end instead of throwing
+		bool overwrites() const
+		{
+			return overwrite;
+		}
+		void set_overwrite(bool enabled)
+		{
+			overwrite = enabled;
+		}
+
+		//the newest elements stay if the buffer gets smaller than its size
+		void set_capacity(size_t capacity)
+		{
+			if (capacity == 0)
+				throw exception("Tried to create circular buffer without capacity");
+			MyVector<T> resized;
+			resized.reserve(capacity);
+			resized.resize(capacity);
+			size_t keep = v_size < capacity ? v_size : capacity;
+			T* data = storage.getData();
+			T* target = resized.getData();
+			for (size_t i = v_size - keep; i < v_size; i++)
+				*target++ = std::move(data[_physical(i)]);
+			storage.swap(resized);
+			head = 0;
+			v_size = keep;
+		}
+
+		T& operator[](size_t index)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return storage.getData()[_physical(index)];
+		}
+		const T& operator[](size_t index) const
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return storage.getData()[_physical(index)];
+		}
+		T& front()
+		{
+			return (*this)[0];
+		}
+		const T& front() const
+		{
+			return (*this)[0];
+		}
+		T& back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds();
+			return (*this)[v_size - 1];
+		}
+		const T& back() const
+		{
+			if (v_size == 0)
+				throw out_of_bounds();
+			return (*this)[v_size - 1];
+		}
+
+		iterator begin()
+		{
+			return iterator(this, 0);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, 0);
+		}
+		iterator end()
+		{
+			return iterator(this, v_size);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, v_size);
+		}
+
+		//in overwrite mode a full buffer drops its oldest element
+		void push_back(const T& val)
+		{
+			emplace_back(val);
+		}
+		void push_back(T&& val)
+		{
+			emplace_back(std::move(val));
+		}
+		template<typename... args>
+		T& emplace_back(args&&... vals)
+		{
+			T* data = storage.getData();
+			T val(std::forward<args>(vals)...);
+			if (v_size == storage.size())
+			{
+				if (!overwrite || v_size == 0)
+					throw exception("Tried to push into full circular buffer");
+				T& slot = data[head];
+				slot = std::move(val);
+				head = _next(head);
+				return slot;
+			}
+			T& slot = data[_physical(v_size)];
+			slot = std::move(val);
+			v_size++;
+			return slot;
+		}
+		//in overwrite mode a full buffer drops its newest element
+		void push_front(const T& val)
+		{
+			emplace_front(val);
+		}
+		void push_front(T&& val)
+		{
+			emplace_front(std::move(val));
+		}
+		template<typename... args>
+		T& emplace_front(args&&... vals)
+		{
+			T* data = storage.getData();
+			T val(std::forward<args>(vals)...);
+			if (v_size == storage.size() && (!overwrite || v_size == 0))
+				throw exception("Tried to push into full circular buffer");
+			head = _previous(head);
+			data[head] = std::move(val);
+			if (v_size < storage.size())
+				v_size++;
+			return data[head];
+		}
+		//appends count elements, in overwrite mode only the last capacity of them can stay
+		template<class Iter>
+		void push_back(Iter firstIt, size_t count)
+		{
+			if (!overwrite && count > storage.size() - v_size)
+				throw exception("Tried to push into full circular buffer");
+			for (size_t i = 0; i < count; i++, ++firstIt)
+				emplace_back(*firstIt);
+		}
+
+		void pop_front()
+		{
+			pop_front(1);
+		}
+		//drops the count oldest elements, for consuming what was read through spans()
+		void pop_front(size_t count)
+		{
+			if (count > v_size)
+				throw out_of_bounds("Tried to pop more elements than the buffer holds");
+			T* data = storage.getData();
+			for (size_t i = 0; i < count; i++)
+			{
+				data[head] = T();
+				head = _next(head);
+			}
+			v_size -= count;
+		}
+		void pop_back()
+		{
+			pop_back(1);
+		}
+		void pop_back(size_t count)
+		{
+			if (count > v_size)
+				throw out_of_bounds("Tried to pop more elements than the buffer holds");
+			T* data = storage.getData();
+			for (size_t i = 0; i < count; i++)
+				data[_physical(--v_size)] = T();
+		}
+		void clear()
+		{
+			pop_front(v_size);
+			head = 0;
+		}
+
+		//the elements in logical order as the part up to the end of storage and the part that wrapped to its start
+		std::pair<MySpan<T>, MySpan<T>> spans()
+		{
+			T* data = storage.getData();
+			size_t firstPart = storage.size() - head < v_size ? storage.size() - head : v_size;
+			return std::make_pair(MySpan<T>(data + head, firstPart), MySpan<T>(data, v_size - firstPart));
+		}
+		std::pair<MySpan<const T>, MySpan<const T>> spans() const
+		{
+			const T* data = storage.getData();
+			size_t firstPart = storage.size() - head < v_size ? storage.size() - head : v_size;
+			return std::make_pair(MySpan<const T>(data + head, firstPart), MySpan<const T>(data, v_size - firstPart));
+		}
+		bool is_linearized() const
+		{
+			return head + v_size <= storage.size();
+		}
+		//rotates the storage so the elements are contiguous from its start, free if they already are
+		MySpan<T> linearize()
+		{
+			T* data = storage.getData();
+			if (!is_linearized())
+			{
+				std::rotate(data, data + head, data + storage.size());
+				head = 0;
+			}
+			return MySpan<T>(data + head, v_size);
+		}
+	private:
+		size_t _physical(size_t index) const
+		{
+			size_t position = head + index;
+			return position >= storage.size() ? position - storage.size() : position;
+		}
+		size_t _next(size_t position) const
+		{
+			return position + 1 == storage.size() ? 0 : position + 1;
+		}
+		size_t _previous(size_t position) const
+		{
+			return position == 0 ? storage.size() - 1 : position - 1;
+		}
+	};
+}
\ No newline at end of file
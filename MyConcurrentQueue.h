@@ -0,0 +1,265 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include "MyNodePool.h"
+#include "MyHazardPointers.h"
+
+namespace MySTL
+{
+	//lock-free multi producer multi consumer fifo queue after Michael and Scott.
+	//the nodes have the layout of MyForwardList nodes and come from the same pool, the front node is a dummy whose payload
+	//was already taken or never existed, removed nodes are reclaimed through MyHazardPointers
+	template<typename T>
+	class MyConcurrentQueue
+	{
+	private:
+		struct NodeBase
+		{
+			std::atomic<NodeBase*> next;
+		};
+		struct Node : public NodeBase
+		{
+			T data;
+			//the payload is constructed in place from whatever the caller passed
+			template<typename... args>
+			Node(NodeBase* next, args&&... vals)
+				:
+				NodeBase{ next },
+				data(std::forward<args>(vals)...)
+			{}
+		};
+		using NodePool = MyNodePool<sizeof(Node), alignof(Node)>;
+
+		//producers only touch tail and consumers only head, so they live on separate cache lines
+		alignas(64) std::atomic<NodeBase*> head;
+		alignas(64) std::atomic<NodeBase*> tail;
+	public:
+		MyConcurrentQueue()
+		{
+			NodeBase* dummy = _createDummy();
+			head.store(dummy, std::memory_order_relaxed);
+			tail.store(dummy, std::memory_order_relaxed);
+		}
+		MyConcurrentQueue(const MyConcurrentQueue&) = delete;
+		MyConcurrentQueue& operator=(const MyConcurrentQueue&) = delete;
+		//must not run concurrently with any other operation on the queue
+		~MyConcurrentQueue()
+		{
+			NodeBase* dummy = head.load(std::memory_order_relaxed);
+			NodeBase* node = dummy->next.load(std::memory_order_relaxed);
+			NodePool::deallocate(dummy);
+			while (node != nullptr)
+			{
+				NodeBase* next = node->next.load(std::memory_order_relaxed);
+				static_cast<Node*>(node)->~Node();
+				NodePool::deallocate(node);
+				node = next;
+			}
+		}
+
+		//only a snapshot, other threads may change it right after
+		bool empty() const
+		{
+			//head is protected first, a consumer may retire it as soon as it is loaded
+			NodeBase* first = MyHazardPointers::protect(0, head);
+			bool result = first->next.load(std::memory_order_acquire) == nullptr;
+			MyHazardPointers::clear(0);
+			return result;
+		}
+
+		void push(const T& val)
+		{
+			emplace(val);
+		}
+		void push(T&& val)
+		{
+			emplace(std::move(val));
+		}
+		template<typename... args>
+		void emplace(args&&... vals)
+		{
+			NodeBase* node = _createNode(std::forward<args>(vals)...);
+			_link(node, node);
+		}
+		//enqueue the whole range with a single link, the elements stay together in their order
+		template<class Iter>
+		void push(Iter firstIt, Iter lastIt)
+		{
+			if (firstIt == lastIt)
+				return;
+			NodeBase* first = _createNode(*firstIt);
+			NodeBase* last = first;
+			try
+			{
+				for (auto it = ++firstIt; it != lastIt; ++it)
+				{
+					NodeBase* node = _createNode(*it);
+					last->next.store(node, std::memory_order_relaxed);
+					last = node;
+				}
+			}
+			catch (...)
+			{
+				_destroyChain(first);
+				throw;
+			}
+			_link(first, last);
+		}
+
+		//moves the front element into val, returns false if the queue was empty
+		bool try_pop(T& val)
+		{
+			return try_pop(&val, 1) == 1;
+		}
+		//moves up to count elements from the front to out with a single unlink, returns how many were taken
+		template<class OutIter>
+		size_t try_pop(OutIter out, size_t count)
+		{
+			if (count == 0)
+				return 0;
+			while (true)
+			{
+				NodeBase* first = MyHazardPointers::protect(0, head);
+				NodeBase* lag = tail.load(std::memory_order_acquire);
+				NodeBase* last = first;
+				size_t taken = 0;
+				bool tailInRange = false;
+				bool headMoved = false;
+				//walk hand over hand, a node behind head cannot be retired while head is still first
+				while (taken < count)
+				{
+					NodeBase* next = last->next.load(std::memory_order_acquire);
+					if (next == nullptr)
+						break;
+					MyHazardPointers::set(1, next);
+					if (head.load() != first)
+					{
+						headMoved = true;
+						break;
+					}
+					if (last == lag)
+						tailInRange = true;
+					last = next;
+					taken++;
+				}
+				if (headMoved)
+					continue;
+				//a retired dummy always has a successor, so no successor means the queue was empty
+				if (taken == 0)
+				{
+					MyHazardPointers::clear(0);
+					return 0;
+				}
+				if (tailInRange)
+				{
+					//never let head pass tail, help the producer that has not swung tail yet
+					MyHazardPointers::set(1, lag);
+					if (tail.load() == lag)
+						tail.compare_exchange_strong(lag, lag->next.load(std::memory_order_acquire));
+					continue;
+				}
+
+				//last becomes the new dummy and stays protected until its payload is moved out
+				if (!head.compare_exchange_strong(first, last))
+					continue;
+
+				NodeBase* node = first->next.load(std::memory_order_relaxed);
+				_retire(first);
+				try
+				{
+					while (true)
+					{
+						//only the payload ends here, last stays the live dummy whose link other threads still use
+						Node* full = static_cast<Node*>(node);
+						*out = std::move(full->data);
+						++out;
+						full->data.~T();
+						if (node == last)
+							break;
+						NodeBase* next = node->next.load(std::memory_order_relaxed);
+						_retire(node);
+						node = next;
+					}
+				}
+				catch (...)
+				{
+					//the nodes are already unlinked, so the payloads that were not moved out are dropped
+					while (true)
+					{
+						static_cast<Node*>(node)->data.~T();
+						if (node == last)
+							break;
+						NodeBase* next = node->next.load(std::memory_order_relaxed);
+						_retire(node);
+						node = next;
+					}
+					MyHazardPointers::clear(1);
+					MyHazardPointers::clear(0);
+					throw;
+				}
+				MyHazardPointers::clear(1);
+				MyHazardPointers::clear(0);
+				return taken;
+			}
+		}
+	private:
+		//append the already linked chain first..last behind the current last node
+		void _link(NodeBase* first, NodeBase* last)
+		{
+			while (true)
+			{
+				NodeBase* end = MyHazardPointers::protect(0, tail);
+				NodeBase* next = end->next.load(std::memory_order_acquire);
+				if (tail.load() != end)
+					continue;
+				if (next != nullptr)
+				{
+					//another producer linked its nodes but did not swing tail yet
+					tail.compare_exchange_weak(end, next);
+					continue;
+				}
+				if (end->next.compare_exchange_weak(next, first))
+				{
+					tail.compare_exchange_strong(end, last);
+					MyHazardPointers::clear(0);
+					return;
+				}
+			}
+		}
+		template<typename... args>
+		static NodeBase* _createNode(args&&... vals)
+		{
+			void* memory = NodePool::allocate();
+			try
+			{
+				return new (memory) Node(nullptr, std::forward<args>(vals)...);
+			}
+			catch (...)
+			{
+				NodePool::deallocate(memory);
+				throw;
+			}
+		}
+		//a node slot with only the link constructed
+		static NodeBase* _createDummy()
+		{
+			return new (NodePool::allocate()) NodeBase{ nullptr };
+		}
+		static void _destroyChain(NodeBase* node)
+		{
+			while (node != nullptr)
+			{
+				NodeBase* next = node->next.load(std::memory_order_relaxed);
+				static_cast<Node*>(node)->~Node();
+				NodePool::deallocate(node);
+				node = next;
+			}
+		}
+		//retired nodes never hold a payload anymore, so reclaiming only returns the memory
+		static void _retire(NodeBase* node)
+		{
+			MyHazardPointers::retire(node, [](void* memory) { NodePool::deallocate(memory); });
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include "MyForwardList.h"
+#include "MyHazardPointers.h"
+
+namespace MySTL
+{
+	//lock-free lifo stack after Treiber on the nodes of MyForwardList<T>, so whole chains move between the two without copies.
+	//a popper protects the top node with MyHazardPointers before it reads its link and popped nodes are retired, so a node
+	//cannot be recycled and pushed again while a pop still compares against it. take_all hands its nodes to a list that
+	//frees them directly, so it waits until no popper protects one of them anymore
+	template<typename T>
+	class MyConcurrentStack
+	{
+	private:
+		using List = MyForwardList<T>;
+		using NodeBase = typename List::NodeBase;
+		using Node = typename List::Node;
+		using NodePool = typename List::NodePool;
+
+		alignas(64) std::atomic<NodeBase*> top;
+	public:
+		MyConcurrentStack()
+			:
+			top(nullptr)
+		{}
+		MyConcurrentStack(const MyConcurrentStack&) = delete;
+		MyConcurrentStack& operator=(const MyConcurrentStack&) = delete;
+		//must not run concurrently with any other operation on the stack
+		~MyConcurrentStack()
+		{
+			take_all();
+		}
+
+		//only a snapshot, other threads may change it right after
+		bool empty() const
+		{
+			return top.load(std::memory_order_acquire) == nullptr;
+		}
+
+		void push_front(const T& val)
+		{
+			emplace_front(val);
+		}
+		void push_front(T&& val)
+		{
+			emplace_front(std::move(val));
+		}
+		template<typename... args>
+		void emplace_front(args&&... vals)
+		{
+			NodeBase* node = List::_createNode(nullptr, std::forward<args>(vals)...);
+			_pushChain(node, node);
+		}
+		//pushes all elements of list with a single CAS, the front of list ends up on top
+		void push_front(List&& list)
+		{
+			NodeBase* last;
+			NodeBase* first = list._releaseChain(last);
+			if (first != nullptr)
+				_pushChain(first, last);
+		}
+
+		//moves the top element into val, returns false if the stack was empty
+		bool pop_front(T& val)
+		{
+			while (true)
+			{
+				NodeBase* node = MyHazardPointers::protect(0, top);
+				if (node == nullptr)
+				{
+					MyHazardPointers::clear(0);
+					return false;
+				}
+				//node may already be popped by another thread, then it is retired but not reclaimed and the CAS fails
+				NodeBase* next = node->next;
+				NodeBase* expected = node;
+				if (top.compare_exchange_strong(expected, next))
+				{
+					MyHazardPointers::clear(0);
+					//only the payload ends here, a popper that still protects node may read its link
+					Node* full = static_cast<Node*>(node);
+					val = std::move(full->data);
+					full->data.~T();
+					MyHazardPointers::retire(node, [](void* memory) { NodePool::deallocate(memory); });
+					return true;
+				}
+			}
+		}
+		//atomically takes every element, the top of the stack becomes the front of the list
+		List take_all()
+		{
+			NodeBase* first = top.exchange(nullptr);
+			MyHazardPointers::waitUntilUnprotected(first);
+			List list;
+			list._adoptChain(first);
+			return list;
+		}
+	private:
+		//links last in front of the current top and makes first the new top
+		void _pushChain(NodeBase* first, NodeBase* last)
+		{
+			NodeBase* current = top.load(std::memory_order_relaxed);
+			do
+			{
+				last->next = current;
+			} while (!top.compare_exchange_weak(current, first, std::memory_order_release, std::memory_order_relaxed));
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <stdexcept>
+#include <atomic>
+#include <new>
+#include <functional>
+#include <iterator>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MySTL
+{
+	//append-only vector for many writer threads. the elements live in segments of doubling size that are never moved,
+	//so references stay valid while other threads append. writers reserve their indices with one fetch-add and
+	//publish every element on its own through a ready flag next to it, so a slow or failed writer never holds up the others.
+	//size() counts reserved indices, an element below it can still be under construction or missing because its
+	//constructor threw, ready() tells and operator[] throws not_ready for those
+	template<typename T>
+	class MyConcurrentVector
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("ConcurrentVector exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class not_ready : public exception
+		{
+		public:
+			not_ready()
+				:
+				exception("Tried to access element that is not constructed")
+			{}
+			not_ready(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+	private:
+		static constexpr size_t firstSegmentBits = 5;
+		static constexpr size_t firstSegmentSize = size_t(1) << firstSegmentBits;
+		//segment k holds firstSegmentSize << k elements, together they cover every size_t index
+		static constexpr size_t segmentCount = sizeof(size_t) * 8 - firstSegmentBits;
+
+		//every segment is followed by one ready flag per element
+		std::atomic<T*> segments[segmentCount];
+		alignas(64) std::atomic<size_t> reserved; //indices handed out to writers
+	public:
+		MyConcurrentVector()
+			:
+			reserved(0)
+		{
+			for (size_t i = 0; i < segmentCount; i++)
+				segments[i].store(nullptr, std::memory_order_relaxed);
+		}
+		MyConcurrentVector(const MyConcurrentVector&) = delete;
+		MyConcurrentVector& operator=(const MyConcurrentVector&) = delete;
+		//must not run concurrently with any other operation on the vector
+		~MyConcurrentVector()
+		{
+			for (size_t i = 0, stop = reserved.load(std::memory_order_relaxed); i < stop; i++)
+			{
+				T* slot = _readySlot(i);
+				if (slot != nullptr)
+					slot->~T();
+			}
+			for (size_t i = 0; i < segmentCount; i++)
+				::operator delete(segments[i].load(std::memory_order_relaxed));
+		}
+
+		T& operator[](size_t index)
+		{
+			return *_checkedSlot(index);
+		}
+		const T& operator[](size_t index) const
+		{
+			return *_checkedSlot(index);
+		}
+		T& at(size_t index)
+		{
+			return (*this)[index];
+		}
+		const T& at(size_t index) const
+		{
+			return (*this)[index];
+		}
+		T& front()
+		{
+			return (*this)[0];
+		}
+		const T& front() const
+		{
+			return (*this)[0];
+		}
+
+		//number of reserved indices, including elements other threads are still constructing
+		size_t size() const
+		{
+			return reserved.load(std::memory_order_acquire);
+		}
+		bool empty() const
+		{
+			return size() == 0;
+		}
+		//whether the element at index is constructed and can be read from any thread
+		bool ready(size_t index) const
+		{
+			return index < size() && _readySlot(index) != nullptr;
+		}
+
+		//if the constructor or the segment allocation throws, the reserved index stays not ready for good
+		void push_back(const T& val)
+		{
+			emplace_back(val);
+		}
+		void push_back(T&& val)
+		{
+			emplace_back(std::move(val));
+		}
+		template<typename... args>
+		T& emplace_back(args&&... vals)
+		{
+			size_t index = reserved.fetch_add(1, std::memory_order_relaxed);
+			T* slot = _reserveSlot(index);
+			new (slot) T(std::forward<args>(vals)...);
+			_publish(slot, index);
+			return *slot;
+		}
+		//reserves n consecutive indices at once and returns the first one. the k-th element of the range is constructed
+		//in place from gen(k) and published once it is complete, after an exception the rest of the range stays not ready
+		template<class Gen>
+		size_t grow_by(size_t n, Gen gen)
+		{
+			size_t first = reserved.fetch_add(n, std::memory_order_relaxed);
+			for (size_t k = 0; k < n; k++)
+			{
+				T* slot = _reserveSlot(first + k);
+				new (slot) T(gen(k));
+				_publish(slot, first + k);
+			}
+			return first;
+		}
+		//appends a copy of the forward range as consecutive indices, returns the index of the first one
+		template<class Iter>
+		size_t grow_by(Iter firstIt, Iter lastIt)
+		{
+			return grow_by(static_cast<size_t>(std::distance(firstIt, lastIt)), [&firstIt](size_t) -> decltype(*firstIt) { return *firstIt++; });
+		}
+
+		/*//////////////////////////////////////////*/
+		/*////Extra Methods (not in std::vector)////*/
+		/*//////////////////////////////////////////*/
+
+		//execute the lambda for every element that is ready, of the indices reserved when the call started
+		void forEach(std::function<void(T&)> lambda)
+		{
+			for (size_t i = 0, stop = size(); i < stop; i++)
+			{
+				T* slot = _readySlot(i);
+				if (slot != nullptr)
+					lambda(*slot);
+			}
+		}
+	private:
+		static size_t _segmentSize(size_t segment)
+		{
+			return firstSegmentSize << segment;
+		}
+		static std::atomic<bool>* _readyFlags(T* memory, size_t segment)
+		{
+			return reinterpret_cast<std::atomic<bool>*>(reinterpret_cast<char*>(memory) + sizeof(T) * _segmentSize(segment));
+		}
+		//the release pairs with the acquire in _readySlot, so a reader that sees the flag sees the whole element
+		void _publish(T* slot, size_t index)
+		{
+			size_t segment, offset;
+			_locate(index, segment, offset);
+			_readyFlags(slot - offset, segment)[offset].store(true, std::memory_order_release);
+		}
+		//the slot of an index that was reserved by this thread, allocates its segment if nobody did yet
+		T* _reserveSlot(size_t index)
+		{
+			size_t segment, offset;
+			_locate(index, segment, offset);
+			T* memory = segments[segment].load(std::memory_order_acquire);
+			if (memory == nullptr)
+			{
+				size_t count = _segmentSize(segment);
+				T* fresh = static_cast<T*>(::operator new(sizeof(T) * count + sizeof(std::atomic<bool>) * count));
+				std::atomic<bool>* flags = _readyFlags(fresh, segment);
+				for (size_t i = 0; i < count; i++)
+					new (flags + i) std::atomic<bool>(false);
+				if (segments[segment].compare_exchange_strong(memory, fresh, std::memory_order_acq_rel))
+					memory = fresh;
+				else
+					::operator delete(fresh);
+			}
+			return memory + offset;
+		}
+		//the slot of index if its element is ready, nullptr otherwise
+		T* _readySlot(size_t index) const
+		{
+			size_t segment, offset;
+			_locate(index, segment, offset);
+			T* memory = segments[segment].load(std::memory_order_acquire);
+			if (memory == nullptr || !_readyFlags(memory, segment)[offset].load(std::memory_order_acquire))
+				return nullptr;
+			return memory + offset;
+		}
+		T* _checkedSlot(size_t index) const
+		{
+			if (index >= size())
+				throw out_of_bounds();
+			T* slot = _readySlot(index);
+			if (slot == nullptr)
+				throw not_ready();
+			return slot;
+		}
+		static void _locate(size_t index, size_t& segment, size_t& offset)
+		{
+			//shifting by the first segment size makes the highest set bit name the segment
+			size_t shifted = index + firstSegmentSize;
+			size_t high = _highestBit(shifted);
+			segment = high - firstSegmentBits;
+			offset = shifted - (size_t(1) << high);
+		}
+		static size_t _highestBit(size_t value)
+		{
+#ifdef _MSC_VER
+			unsigned long bit;
+#ifdef _WIN64
+			_BitScanReverse64(&bit, value);
+#else
+			_BitScanReverse(&bit, value);
+#endif
+			return bit;
+#else
+			return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+#endif
+		}
+	};
+}
\ No newline at end of file
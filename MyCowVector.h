@@ -0,0 +1,518 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+#include <new>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//vector whose copies share one reference counted buffer, the first change through a copy clones it.
+	//read through a const reference, cbegin or the const accessors to keep sharing, every non const access
+	//clones a shared buffer first. once a mutable reference or iterator was handed out, later copies of this
+	//vector get their own buffer so writes through it can not show up in them.
+	//copies can be read and changed on different threads, one vector object is not thread safe
+	template<typename T>
+	class MyCowVector
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("CowVector exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+	private:
+		//header in front of the elements of one allocation
+		struct Buffer
+		{
+			std::atomic<size_t> refs;
+			size_t v_size;
+			size_t v_capacity;
+
+			T* elements()
+			{
+				return reinterpret_cast<T*>(reinterpret_cast<char*>(this) + headerSize);
+			}
+		};
+		static constexpr size_t headerSize = (sizeof(Buffer) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+		Buffer* buffer; //nullptr while nothing was added
+		bool exposed; //a mutable reference into buffer was handed out
+	public:
+		MyCowVector()
+			:
+			buffer(nullptr),
+			exposed(false)
+		{}
+		MyCowVector(size_t n, const T& val = T())
+			:
+			MyCowVector()
+		{
+			reserve(n);
+			for (size_t i = 0; i < n; i++)
+				_emplaceBack(val);
+		}
+		template<class Iter, typename = typename std::enable_if<!std::is_integral<Iter>::value>::type>
+		MyCowVector(Iter firstIt, Iter lastIt)
+			:
+			MyCowVector()
+		{
+			for (auto it = firstIt; it != lastIt; ++it)
+				_emplaceBack(*it);
+		}
+		MyCowVector(std::initializer_list<T> list)
+			:
+			MyCowVector(list.begin(), list.end())
+		{}
+		explicit MyCowVector(const MyVector<T>& vec)
+			:
+			MyCowVector()
+		{
+			reserve(vec.size());
+			for (size_t i = 0; i < vec.size(); i++)
+				_emplaceBack(vec[i]);
+		}
+		//O(1) unless copy handed out mutable references
+		MyCowVector(const MyCowVector& copy)
+			:
+			buffer(copy.buffer),
+			exposed(false)
+		{
+			if (buffer == nullptr)
+				return;
+			if (copy.exposed)
+				buffer = _clone(copy.buffer, copy.buffer->v_capacity);
+			else
+				buffer->refs.fetch_add(1, std::memory_order_relaxed);
+		}
+		MyCowVector(MyCowVector&& donor) noexcept
+			:
+			buffer(donor.buffer),
+			exposed(donor.exposed)
+		{
+			donor.buffer = nullptr;
+			donor.exposed = false;
+		}
+		~MyCowVector()
+		{
+			_release(buffer);
+		}
+
+		MyCowVector& operator=(const MyCowVector& copy)
+		{
+			if (&copy != this)
+			{
+				MyCowVector temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyCowVector& operator=(MyCowVector&& donor) noexcept
+		{
+			if (&donor != this)
+			{
+				MyCowVector temp(std::move(donor));
+				swap(temp);
+			}
+			return *this;
+		}
+		void swap(MyCowVector& other) noexcept
+		{
+			std::swap(buffer, other.buffer);
+			std::swap(exposed, other.exposed);
+		}
+
+		const T& operator[](size_t index) const
+		{
+			if (index >= size())
+				throw out_of_bounds();
+			return buffer->elements()[index];
+		}
+		T& operator[](size_t index)
+		{
+			if (index >= size())
+				throw out_of_bounds();
+			return _mutableData()[index];
+		}
+		const T& at(size_t n) const
+		{
+			return (*this)[n];
+		}
+		T& at(size_t n)
+		{
+			return (*this)[n];
+		}
+		const T& front() const
+		{
+			if (empty())
+				throw out_of_bounds("Tried to access element in empty vector");
+			return buffer->elements()[0];
+		}
+		const T& back() const
+		{
+			if (empty())
+				throw out_of_bounds("Tried to access element in empty vector");
+			return buffer->elements()[size() - 1];
+		}
+		//sets element index without handing out a reference, so later copies still share
+		void set(size_t index, const T& val)
+		{
+			if (index >= size())
+				throw out_of_bounds();
+			T copy(val);
+			_makeUnique(0);
+			buffer->elements()[index] = std::move(copy);
+		}
+
+		size_t size() const
+		{
+			return buffer == nullptr ? 0 : buffer->v_size;
+		}
+		size_t capacity() const
+		{
+			return buffer == nullptr ? 0 : buffer->v_capacity;
+		}
+		bool empty() const
+		{
+			return size() == 0;
+		}
+		//how many vectors share the buffer, 0 without a buffer
+		size_t use_count() const
+		{
+			return buffer == nullptr ? 0 : buffer->refs.load(std::memory_order_relaxed);
+		}
+		const T* getData() const
+		{
+			return buffer == nullptr ? nullptr : buffer->elements();
+		}
+
+		const_iterator begin() const
+		{
+			return getData();
+		}
+		const_iterator end() const
+		{
+			return getData() + size();
+		}
+		const_iterator cbegin() const
+		{
+			return getData();
+		}
+		const_iterator cend() const
+		{
+			return getData() + size();
+		}
+		iterator begin()
+		{
+			return _mutableData();
+		}
+		iterator end()
+		{
+			return _mutableData() + size();
+		}
+
+		void reserve(size_t capacity)
+		{
+			if (capacity > this->capacity())
+				_makeUnique(capacity);
+		}
+		void resize(size_t n, const T& val = T())
+		{
+			T copy(val);
+			_makeUnique(n);
+			while (buffer->v_size > n)
+				pop_back();
+			while (buffer->v_size < n)
+				_emplaceBack(copy);
+		}
+		void clear()
+		{
+			if (_isShared())
+			{
+				_release(buffer);
+				buffer = nullptr;
+				exposed = false;
+				return;
+			}
+			while (!empty())
+				pop_back();
+		}
+
+		template<typename... args>
+		T& emplace_back(args&&... vals)
+		{
+			T& added = _emplaceBack(std::forward<args>(vals)...);
+			exposed = true;
+			return added;
+		}
+		void push_back(const T& val)
+		{
+			_emplaceBack(val);
+		}
+		void push_back(T&& val)
+		{
+			_emplaceBack(std::move(val));
+		}
+		void pop_back()
+		{
+			if (empty())
+				throw out_of_bounds("Tried to erase element out of bounds");
+			_makeUnique(0);
+			buffer->elements()[--buffer->v_size].~T();
+		}
+
+		iterator insert(const_iterator position, const T& val)
+		{
+			size_t index = _index(position);
+			T copy(val);
+			size_t count = size();
+			_makeUnique(count == capacity() ? _growth(count + 1) : 0);
+			T* data = buffer->elements();
+			if (index == count)
+			{
+				new (data + count) T(std::move(copy));
+			}
+			else
+			{
+				new (data + count) T(std::move(data[count - 1]));
+				for (size_t i = count - 1; i > index; i--)
+					data[i] = std::move(data[i - 1]);
+				data[index] = std::move(copy);
+			}
+			buffer->v_size++;
+			exposed = true;
+			return data + index;
+		}
+		iterator erase(const_iterator position)
+		{
+			size_t index = _index(position);
+			if (index == size())
+				throw out_of_bounds("Tried to erase element out of bounds");
+			return erase(position, position + 1);
+		}
+		iterator erase(const_iterator firstIt, const_iterator lastIt)
+		{
+			size_t first = _index(firstIt);
+			size_t last = _index(lastIt);
+			if (first > last)
+				throw bad_iterator("Tried to erase a range that ends before it starts");
+			//an empty range would move every later element onto itself, a vector without buffer only has empty ranges
+			if (first == last)
+				return _mutableData() + first;
+			T* data = _mutableData();
+			for (size_t i = last; i < buffer->v_size; i++)
+				data[i - (last - first)] = std::move(data[i]);
+			for (size_t i = last - first; i > 0; i--)
+				data[--buffer->v_size].~T();
+			return data + first;
+		}
+
+		/*//////////////////////////////////////////*/
+		/*////Extra Methods (not in std::vector)////*/
+		/*//////////////////////////////////////////*/
+
+		//check if the vector contains the element by using the == operator
+		bool contains(const T& val) const
+		{
+			for (const T* it = cbegin(), *stop = cend(); it != stop; ++it)
+			{
+				if (*it == val)
+					return true;
+			}
+			return false;
+		}
+		//return how often the vector contains an item using the == operator
+		size_t count(const T& val) const
+		{
+			size_t ret = 0;
+			for (const T* it = cbegin(), *stop = cend(); it != stop; ++it)
+			{
+				if (*it == val)
+					ret++;
+			}
+			return ret;
+		}
+		//split the vector at the first occurence of the element (none of the returned values contains val)
+		std::pair<MyCowVector, MyCowVector> split(const T& val) const
+		{
+			const T* first = cbegin();
+			const T* stop = cend();
+			const T* it = first;
+			while (it != stop && !(*it == val))
+				++it;
+			std::pair<MyCowVector, MyCowVector> parts;
+			parts.first = MyCowVector(first, it);
+			if (it != stop)
+				parts.second = MyCowVector(it + 1, stop);
+			return parts;
+		}
+	private:
+		static Buffer* _allocate(size_t capacity)
+		{
+			Buffer* allocated = static_cast<Buffer*>(::operator new(headerSize + sizeof(T) * capacity));
+			new (allocated) Buffer();
+			allocated->refs.store(1, std::memory_order_relaxed);
+			allocated->v_size = 0;
+			allocated->v_capacity = capacity;
+			return allocated;
+		}
+		//new buffer with copies of the elements of source
+		static Buffer* _clone(Buffer* source, size_t capacity)
+		{
+			Buffer* copy = _allocate(capacity);
+			T* from = source->elements();
+			T* to = copy->elements();
+			size_t count = source->v_size;
+			size_t i = 0;
+			try
+			{
+				//counting in a local keeps the loop free of stores to the header
+				for (; i < count; i++)
+					new (to + i) T(from[i]);
+			}
+			catch (...)
+			{
+				copy->v_size = i;
+				_release(copy);
+				throw;
+			}
+			copy->v_size = count;
+			return copy;
+		}
+		static void _release(Buffer* released)
+		{
+			if (released == nullptr || released->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+			T* data = released->elements();
+			for (size_t i = 0; i < released->v_size; i++)
+				data[i].~T();
+			released->~Buffer();
+			::operator delete(released);
+		}
+
+		//acquire like in _makeUnique, so a buffer that another owner just released can be written right away
+		bool _isShared() const
+		{
+			return buffer != nullptr && buffer->refs.load(std::memory_order_acquire) != 1;
+		}
+		//makes buffer exclusive to this vector with room for at least capacity elements
+		void _makeUnique(size_t capacity)
+		{
+			if (buffer == nullptr)
+			{
+				buffer = _allocate(capacity);
+				exposed = false;
+				return;
+			}
+			size_t newCapacity = capacity > buffer->v_capacity ? capacity : buffer->v_capacity;
+			//acquire pairs with the release of other owners, their reads of the buffer are done before we write
+			if (buffer->refs.load(std::memory_order_acquire) != 1)
+			{
+				Buffer* copy = _clone(buffer, newCapacity);
+				_release(buffer);
+				buffer = copy;
+				exposed = false;
+			}
+			else if (newCapacity > buffer->v_capacity)
+			{
+				Buffer* grown = _allocate(newCapacity);
+				T* from = buffer->elements();
+				T* to = grown->elements();
+				size_t count = buffer->v_size;
+				size_t i = 0;
+				try
+				{
+					//copies if the move could throw, so the old buffer stays intact
+					for (; i < count; i++)
+						new (to + i) T(std::move_if_noexcept(from[i]));
+				}
+				catch (...)
+				{
+					grown->v_size = i;
+					_release(grown);
+					throw;
+				}
+				grown->v_size = count;
+				_release(buffer);
+				buffer = grown;
+				exposed = false;
+			}
+		}
+		template<typename... args>
+		T& _emplaceBack(args&&... vals)
+		{
+			size_t count = size();
+			if (count == capacity() || _isShared())
+			{
+				//vals may refer to an element of the old buffer
+				T val(std::forward<args>(vals)...);
+				_makeUnique(count == capacity() ? _growth(count + 1) : 0);
+				new (buffer->elements() + count) T(std::move(val));
+			}
+			else
+			{
+				new (buffer->elements() + count) T(std::forward<args>(vals)...);
+			}
+			buffer->v_size++;
+			return buffer->elements()[count];
+		}
+		T* _mutableData()
+		{
+			if (buffer == nullptr)
+				return nullptr;
+			_makeUnique(0);
+			exposed = true;
+			return buffer->elements();
+		}
+		size_t _index(const_iterator position) const
+		{
+			if (position < cbegin() || position > cend())
+				throw bad_iterator("Tried to pass iterator from different vector");
+			return size_t(position - cbegin());
+		}
+		size_t _growth(size_t needed) const
+		{
+			size_t grown = capacity() + capacity() / 2;
+			return grown < needed ? needed : grown;
+		}
+	};
+}
\ No newline at end of file
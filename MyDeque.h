@@ -0,0 +1,594 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <new>
+#include <cstring>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//double ended queue on fixed size blocks, a map of block pointers with room on both sides finds the block of an element.
+	//elements never move when pushing or popping at the ends, blocks emptied by pops are kept and reused by later pushes,
+	//so a queue that stays around the same size stops allocating
+	template<typename T>
+	class MyDeque
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("Deque exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+	private:
+		static constexpr size_t _log2(size_t n)
+		{
+			size_t shift = 0;
+			while ((size_t(1) << (shift + 1)) <= n)
+				shift++;
+			return shift;
+		}
+		//about 4 KiB per block, but at least 16 elements, as a power of two so positions split with a shift and a mask
+		static constexpr size_t blockShift = _log2(4096 / sizeof(T) > 16 ? 4096 / sizeof(T) : 16);
+		static constexpr size_t blockSize = size_t(1) << blockShift;
+		static constexpr size_t blockMask = blockSize - 1;
+		static constexpr size_t minMapSize = 8;
+
+		//random access over the logical positions, stays valid across pushes and pops at the other end
+		template<bool IsConst>
+		class basic_iterator
+		{
+		public:
+			using deque_type = typename std::conditional<IsConst, const MyDeque, MyDeque>::type;
+			using value_type = T;
+			using reference = typename std::conditional<IsConst, const T&, T&>::type;
+			using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+		private:
+			friend class MyDeque;
+			template<bool> friend class basic_iterator;
+
+			deque_type* deque;
+			size_t index;
+
+			basic_iterator(deque_type* deque, size_t index)
+				:
+				deque(deque),
+				index(index)
+			{}
+		public:
+			basic_iterator()
+				:
+				deque(nullptr),
+				index(0)
+			{}
+			//a mutable iterator converts to a const one
+			template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+			basic_iterator(const basic_iterator<WasConst>& other)
+				:
+				deque(other.deque),
+				index(other.index)
+			{}
+
+			reference operator*() const
+			{
+				return (*deque)[index];
+			}
+			pointer operator->() const
+			{
+				return &(*deque)[index];
+			}
+			reference operator[](difference_type n) const
+			{
+				return (*deque)[index + n];
+			}
+
+			basic_iterator& operator++()
+			{
+				if (++index > deque->v_size)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				return *this;
+			}
+			basic_iterator operator++(int)
+			{
+				basic_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			basic_iterator& operator--()
+			{
+				if (index-- == 0)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				return *this;
+			}
+			basic_iterator operator--(int)
+			{
+				basic_iterator result(*this);
+				--(*this);
+				return result;
+			}
+			basic_iterator& operator+=(difference_type n)
+			{
+				if (n > 0 ? index + n > deque->v_size : size_t(-n) > index)
+					throw out_of_bounds("Tried to move iterator out of bounds");
+				index += n;
+				return *this;
+			}
+			basic_iterator& operator-=(difference_type n)
+			{
+				return *this += -n;
+			}
+			basic_iterator operator+(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result += n;
+			}
+			friend basic_iterator operator+(difference_type n, const basic_iterator& it)
+			{
+				return it + n;
+			}
+			basic_iterator operator-(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result -= n;
+			}
+			difference_type operator-(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return difference_type(index) - difference_type(other.index);
+			}
+
+			bool operator==(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index == other.index;
+			}
+			bool operator!=(const basic_iterator& other) const
+			{
+				return !(*this == other);
+			}
+			bool operator<(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index < other.index;
+			}
+			bool operator>(const basic_iterator& other) const
+			{
+				return other < *this;
+			}
+			bool operator<=(const basic_iterator& other) const
+			{
+				return !(other < *this);
+			}
+			bool operator>=(const basic_iterator& other) const
+			{
+				return !(*this < other);
+			}
+		private:
+			void _validateCompare(const basic_iterator& other) const
+			{
+				if (deque != other.deque)
+					throw bad_iterator("Tried to compare iterators of different deques");
+			}
+		};
+	public:
+		using value_type = T;
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+	private:
+		T** blockMap; //only map[firstBlock, firstBlock + usedBlocks) point to blocks
+		size_t mapSize;
+		size_t firstBlock;
+		size_t usedBlocks;
+		size_t start; //offset of the first element in the first block, up to blockSize
+		size_t v_size;
+		MyVector<T*> spareBlocks; //emptied blocks waiting for reuse, its capacity is kept at mapSize
+	public:
+		MyDeque()
+			:
+			blockMap(nullptr),
+			mapSize(0),
+			firstBlock(0),
+			usedBlocks(0),
+			start(0),
+			v_size(0)
+		{}
+		MyDeque(std::initializer_list<T> list)
+			:
+			MyDeque()
+		{
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				push_back(*it);
+		}
+		MyDeque(const MyDeque& copy)
+			:
+			MyDeque()
+		{
+			for (size_t i = 0; i < copy.v_size; i++)
+				push_back(copy._element(i));
+		}
+		MyDeque(MyDeque&& donor) noexcept
+			:
+			MyDeque()
+		{
+			swap(donor);
+		}
+		~MyDeque()
+		{
+			clear();
+			shrink_to_fit();
+			delete[] blockMap;
+		}
+
+		MyDeque& operator=(const MyDeque& copy)
+		{
+			if (&copy != this)
+			{
+				MyDeque temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyDeque& operator=(MyDeque&& donor) noexcept
+		{
+			if (&donor != this)
+			{
+				MyDeque temp(std::move(donor));
+				swap(temp);
+			}
+			return *this;
+		}
+
+		T& operator[](size_t index)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return _element(index);
+		}
+		const T& operator[](size_t index) const
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return _element(index);
+		}
+		T& at(size_t index)
+		{
+			return (*this)[index];
+		}
+		const T& at(size_t index) const
+		{
+			return (*this)[index];
+		}
+		T& front()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty deque");
+			return _element(0);
+		}
+		const T& front() const
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty deque");
+			return _element(0);
+		}
+		T& back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty deque");
+			return _element(v_size - 1);
+		}
+		const T& back() const
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty deque");
+			return _element(v_size - 1);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		void swap(MyDeque& other) noexcept
+		{
+			std::swap(blockMap, other.blockMap);
+			std::swap(mapSize, other.mapSize);
+			std::swap(firstBlock, other.firstBlock);
+			std::swap(usedBlocks, other.usedBlocks);
+			std::swap(start, other.start);
+			std::swap(v_size, other.v_size);
+			spareBlocks.swap(other.spareBlocks);
+		}
+
+		iterator begin()
+		{
+			return iterator(this, 0);
+		}
+		const_iterator begin() const
+		{
+			return const_iterator(this, 0);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, 0);
+		}
+		iterator end()
+		{
+			return iterator(this, v_size);
+		}
+		const_iterator end() const
+		{
+			return const_iterator(this, v_size);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, v_size);
+		}
+
+		template<typename... args>
+		T& emplace_back(args&&... vals)
+		{
+			size_t position = start + v_size;
+			if ((position >> blockShift) == usedBlocks)
+				_addBlockBack();
+			T* slot = &blockMap[firstBlock + (position >> blockShift)][position & blockMask];
+			new (slot) T(std::forward<args>(vals)...);
+			v_size++;
+			return *slot;
+		}
+		template<typename... args>
+		T& emplace_front(args&&... vals)
+		{
+			if (start == 0)
+				_addBlockFront();
+			T* slot = &blockMap[firstBlock][start - 1];
+			new (slot) T(std::forward<args>(vals)...);
+			start--;
+			v_size++;
+			return *slot;
+		}
+		void push_back(const T& val)
+		{
+			emplace_back(val);
+		}
+		void push_back(T&& val)
+		{
+			emplace_back(std::move(val));
+		}
+		void push_front(const T& val)
+		{
+			emplace_front(val);
+		}
+		void push_front(T&& val)
+		{
+			emplace_front(std::move(val));
+		}
+		void pop_back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to pop from an empty deque");
+			_element(v_size - 1).~T();
+			v_size--;
+			//keeps the block the back is in, even when the deque became empty
+			while (usedBlocks > 1 && (usedBlocks - 1) << blockShift >= start + v_size)
+				_releaseBlock(blockMap[firstBlock + --usedBlocks]);
+		}
+		void pop_front()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to pop from an empty deque");
+			_element(0).~T();
+			v_size--;
+			//start can already be at blockSize if an emplace_front threw after adding a block
+			if (++start >= blockSize)
+			{
+				_releaseBlock(blockMap[firstBlock++]);
+				usedBlocks--;
+				start -= blockSize;
+			}
+		}
+
+		//shifts the shorter side of the deque by one
+		iterator insert(const_iterator position, const T& val)
+		{
+			return emplace(position, val);
+		}
+		iterator insert(const_iterator position, T&& val)
+		{
+			return emplace(position, std::move(val));
+		}
+		template<typename... args>
+		iterator emplace(const_iterator position, args&&... vals)
+		{
+			if (position.deque != this)
+				throw bad_iterator("Tried to pass iterator from different deque");
+			size_t index = position.index;
+			if (index == 0)
+			{
+				emplace_front(std::forward<args>(vals)...);
+				return begin();
+			}
+			if (index == v_size)
+			{
+				emplace_back(std::forward<args>(vals)...);
+				return end() - 1;
+			}
+			T val(std::forward<args>(vals)...);
+			if (index < v_size / 2)
+			{
+				push_front(std::move(_element(0)));
+				for (size_t i = 1; i < index; i++)
+					_element(i) = std::move(_element(i + 1));
+			}
+			else
+			{
+				push_back(std::move(_element(v_size - 1)));
+				for (size_t i = v_size - 2; i > index; i--)
+					_element(i) = std::move(_element(i - 1));
+			}
+			_element(index) = std::move(val);
+			return iterator(this, index);
+		}
+		iterator erase(const_iterator position)
+		{
+			if (position.deque != this)
+				throw bad_iterator("Tried to pass iterator from different deque");
+			size_t index = position.index;
+			if (index >= v_size)
+				throw out_of_bounds("Tried to erase element out of bounds");
+			if (index < v_size / 2)
+			{
+				for (size_t i = index; i > 0; i--)
+					_element(i) = std::move(_element(i - 1));
+				pop_front();
+			}
+			else
+			{
+				for (size_t i = index; i + 1 < v_size; i++)
+					_element(i) = std::move(_element(i + 1));
+				pop_back();
+			}
+			return iterator(this, index);
+		}
+
+		void resize(size_t n, const T& val = T())
+		{
+			while (v_size > n)
+				pop_back();
+			while (v_size < n)
+				push_back(val);
+		}
+		//destroys every element, the blocks are kept for reuse
+		void clear()
+		{
+			for (size_t i = 0; i < v_size; i++)
+				_element(i).~T();
+			for (size_t i = 0; i < usedBlocks; i++)
+				_releaseBlock(blockMap[firstBlock + i]);
+			firstBlock = mapSize / 2;
+			usedBlocks = 0;
+			start = 0;
+			v_size = 0;
+		}
+		//frees the blocks kept for reuse
+		void shrink_to_fit()
+		{
+			for (size_t i = 0; i < spareBlocks.size(); i++)
+				::operator delete(spareBlocks[i]);
+			spareBlocks.resize(0);
+		}
+
+		//check if the deque contains the element by using the == operator
+		bool contains(const T& val) const
+		{
+			for (size_t i = 0; i < v_size; i++)
+			{
+				if (_element(i) == val)
+					return true;
+			}
+			return false;
+		}
+	private:
+		T& _element(size_t index) const
+		{
+			size_t position = start + index;
+			return blockMap[firstBlock + (position >> blockShift)][position & blockMask];
+		}
+
+		T* _takeBlock()
+		{
+			if (spareBlocks.empty())
+				return static_cast<T*>(::operator new(sizeof(T) * blockSize));
+			T* block = spareBlocks[spareBlocks.size() - 1];
+			spareBlocks.resize(spareBlocks.size() - 1);
+			return block;
+		}
+		//never allocates, every block ever taken fits into the map, so the spares fit into the capacity reserved by _makeRoom.
+		//at most as many spares as blocks in use are kept, so a deque that once peaked does not hold on to all its blocks
+		void _releaseBlock(T* block) noexcept
+		{
+			if (spareBlocks.size() < usedBlocks)
+				spareBlocks.push_back(block);
+			else
+				::operator delete(block);
+		}
+		void _addBlockBack()
+		{
+			if (firstBlock + usedBlocks == mapSize)
+				_makeRoom();
+			blockMap[firstBlock + usedBlocks] = _takeBlock();
+			usedBlocks++;
+		}
+		void _addBlockFront()
+		{
+			if (firstBlock == 0)
+				_makeRoom();
+			blockMap[firstBlock - 1] = _takeBlock();
+			firstBlock--;
+			usedBlocks++;
+			start += blockSize;
+		}
+		//centers the used block pointers again, in a map twice the size if more than half of it is in use
+		void _makeRoom()
+		{
+			size_t newMapSize = mapSize;
+			if (2 * (usedBlocks + 1) > mapSize)
+				newMapSize = mapSize * 2 > minMapSize ? mapSize * 2 : minMapSize;
+			spareBlocks.reserve(newMapSize);
+			size_t newFirstBlock = (newMapSize - usedBlocks) / 2;
+			if (newMapSize == mapSize)
+			{
+				std::memmove(blockMap + newFirstBlock, blockMap + firstBlock, usedBlocks * sizeof(T*));
+			}
+			else
+			{
+				T** newMap = new T*[newMapSize];
+				if (usedBlocks != 0)
+					std::memcpy(newMap + newFirstBlock, blockMap + firstBlock, usedBlocks * sizeof(T*));
+				delete[] blockMap;
+				blockMap = newMap;
+				mapSize = newMapSize;
+			}
+			firstBlock = newFirstBlock;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,473 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "MyVector.h"
+#include "MySpan.h"
+#include "MyFlatSearch.h"
+
+namespace MySTL
+{
+	//sorted map on two MyVectors, one with the keys and one with the values at the same positions.
+	//searches only touch the key array, inserting and erasing single elements shifts the elements behind them.
+	//tables that are filled once can push_unsorted everything and sort a single time in freeze(),
+	//which also builds an Eytzinger copy of the keys for faster searches until the next change
+	template<typename K, typename V, typename Comp = std::less<K>>
+	class MyFlatMap
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("FlatMap exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<K, V>;
+	private:
+		//random access over the positions, dereferencing yields a pair of references into both arrays
+		template<bool IsConst>
+		class basic_iterator
+		{
+		public:
+			using map_type = typename std::conditional<IsConst, const MyFlatMap, MyFlatMap>::type;
+			using mapped_reference = typename std::conditional<IsConst, const V&, V&>::type;
+			using value_type = MyFlatMap::value_type;
+			using reference = std::pair<const K&, mapped_reference>;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+		private:
+			friend class MyFlatMap;
+			template<bool> friend class basic_iterator;
+
+			map_type* map;
+			size_t index;
+
+			basic_iterator(map_type* map, size_t index)
+				:
+				map(map),
+				index(index)
+			{}
+		public:
+			//a mutable iterator converts to a const one
+			template<bool WasConst, typename = typename std::enable_if<IsConst && !WasConst>::type>
+			basic_iterator(const basic_iterator<WasConst>& other)
+				:
+				map(other.map),
+				index(other.index)
+			{}
+
+			reference operator*() const
+			{
+				return reference(key(), value());
+			}
+			const K& key() const
+			{
+				if (index >= map->keys.size())
+					throw out_of_bounds("Tried to dereference end iterator");
+				return map->keys.getData()[index];
+			}
+			mapped_reference value() const
+			{
+				if (index >= map->keys.size())
+					throw out_of_bounds("Tried to dereference end iterator");
+				return map->vals.getData()[index];
+			}
+
+			basic_iterator& operator++()
+			{
+				if (++index > map->keys.size())
+					throw out_of_bounds("Tried to increment iterator past the end");
+				return *this;
+			}
+			basic_iterator operator++(int)
+			{
+				basic_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			basic_iterator& operator--()
+			{
+				if (index-- == 0)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				return *this;
+			}
+			basic_iterator operator--(int)
+			{
+				basic_iterator result(*this);
+				--(*this);
+				return result;
+			}
+			basic_iterator& operator+=(difference_type n)
+			{
+				if (n > 0 ? index + n > map->keys.size() : size_t(-n) > index)
+					throw out_of_bounds("Tried to move iterator out of bounds");
+				index += n;
+				return *this;
+			}
+			basic_iterator operator+(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result += n;
+			}
+			basic_iterator operator-(difference_type n) const
+			{
+				basic_iterator result(*this);
+				return result += -n;
+			}
+			difference_type operator-(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return difference_type(index) - difference_type(other.index);
+			}
+
+			bool operator==(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index == other.index;
+			}
+			bool operator!=(const basic_iterator& other) const
+			{
+				return !(*this == other);
+			}
+			bool operator<(const basic_iterator& other) const
+			{
+				_validateCompare(other);
+				return index < other.index;
+			}
+		private:
+			void _validateCompare(const basic_iterator& other) const
+			{
+				if (map != other.map)
+					throw bad_iterator("Tried to compare iterators of different maps");
+			}
+		};
+	public:
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+	private:
+		MyVector<K> keys;
+		MyVector<V> vals;
+		FlatSearch::EytzingerIndex<K> searchIndex;
+		bool isSorted = true; //false after push_unsorted until the next freeze or change
+		bool isFrozen = false; //the Eytzinger index matches the keys
+		Comp comp;
+	public:
+		MyFlatMap() = default;
+		MyFlatMap(std::initializer_list<value_type> list)
+		{
+			reserve(list.size());
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				push_unsorted(it->first, it->second);
+			_ensureSorted();
+		}
+
+		size_t size() const
+		{
+			return keys.size();
+		}
+		bool empty() const
+		{
+			return keys.empty();
+		}
+		void reserve(size_t capacity)
+		{
+			keys.reserve(capacity);
+			vals.reserve(capacity);
+		}
+		void clear()
+		{
+			keys.clear();
+			vals.clear();
+			searchIndex.clear();
+			isSorted = true;
+			isFrozen = false;
+		}
+
+		//the keys in ascending order and the values at the same positions
+		MySpan<const K> key_span() const
+		{
+			return MySpan<const K>(keys.getData(), keys.size());
+		}
+		MySpan<V> value_span()
+		{
+			return MySpan<V>(vals.getData(), vals.size());
+		}
+		MySpan<const V> value_span() const
+		{
+			return MySpan<const V>(vals.getData(), vals.size());
+		}
+
+		iterator begin()
+		{
+			return iterator(this, 0);
+		}
+		const_iterator begin() const
+		{
+			return const_iterator(this, 0);
+		}
+		iterator end()
+		{
+			return iterator(this, keys.size());
+		}
+		const_iterator end() const
+		{
+			return const_iterator(this, keys.size());
+		}
+
+		//appends without keeping the order, the table can not be searched until freeze() sorted it.
+		//of several equal keys the one pushed last is kept
+		void push_unsorted(const K& key, const V& val)
+		{
+			_thaw();
+			if (isSorted && !keys.empty() && !comp(keys.getData()[keys.size() - 1], key))
+				isSorted = false;
+			keys.push_back(key);
+			vals.push_back(val);
+		}
+		//sorts what was pushed unsorted and builds the Eytzinger index, searches use it until the next change
+		void freeze()
+		{
+			_ensureSorted();
+			if (!isFrozen)
+			{
+				searchIndex.build(keys.getData(), keys.size());
+				isFrozen = true;
+			}
+		}
+		bool frozen() const
+		{
+			return isFrozen;
+		}
+
+		//does nothing if the key is already in the map
+		std::pair<iterator, bool> insert(const K& key, const V& val)
+		{
+			_ensureSorted();
+			size_t position = _lowerBound(key);
+			if (_matches(position, key))
+				return std::make_pair(iterator(this, position), false);
+			_thaw();
+			keys.insert(keys.begin() + position, key);
+			vals.insert(vals.begin() + position, val);
+			return std::make_pair(iterator(this, position), true);
+		}
+		std::pair<iterator, bool> insert(const value_type& val)
+		{
+			return insert(val.first, val.second);
+		}
+		std::pair<iterator, bool> insert_or_assign(const K& key, const V& val)
+		{
+			std::pair<iterator, bool> result = insert(key, val);
+			if (!result.second)
+				vals[result.first.index] = val;
+			return result;
+		}
+		V& operator[](const K& key)
+		{
+			_ensureSorted();
+			size_t position = _lowerBound(key);
+			if (!_matches(position, key))
+				return vals[insert(key, V()).first.index];
+			return vals[position];
+		}
+		//merges a range of pairs sorted by key in one pass over both, keys already in the map keep their value.
+		//of several equal keys in the range the first one is used
+		template<class Iter>
+		void insert_sorted(Iter firstIt, Iter lastIt)
+		{
+			for (Iter previous = firstIt, it = firstIt; it != lastIt; previous = it)
+			{
+				if (++it != lastIt && comp(it->first, previous->first))
+					throw exception("insert_sorted needs a range sorted by key");
+			}
+			_ensureSorted();
+			_thaw();
+			MyVector<K> mergedKeys;
+			MyVector<V> mergedVals;
+			mergedKeys.reserve(keys.size() + std::distance(firstIt, lastIt));
+			mergedVals.reserve(mergedKeys.capacity());
+			size_t i = 0;
+			while (firstIt != lastIt || i < keys.size())
+			{
+				if (firstIt == lastIt || (i < keys.size() && !comp(firstIt->first, keys[i])))
+				{
+					//the existing element comes first or has the same key
+					if (firstIt != lastIt && !comp(keys[i], firstIt->first))
+						++firstIt;
+					mergedKeys.push_back(std::move(keys[i]));
+					mergedVals.push_back(std::move(vals[i]));
+					i++;
+				}
+				else if (mergedKeys.empty() || comp(mergedKeys[mergedKeys.size() - 1], firstIt->first))
+				{
+					mergedKeys.push_back(firstIt->first);
+					mergedVals.push_back(firstIt->second);
+					++firstIt;
+				}
+				else
+				{
+					++firstIt;
+				}
+			}
+			keys.swap(mergedKeys);
+			vals.swap(mergedVals);
+		}
+		template<typename Range>
+		void insert_sorted(const Range& range)
+		{
+			insert_sorted(std::begin(range), std::end(range));
+		}
+
+		V& at(const K& key)
+		{
+			size_t position = _find(key);
+			if (position == keys.size())
+				throw out_of_bounds("Tried to access key that is not in the map");
+			return vals[position];
+		}
+		const V& at(const K& key) const
+		{
+			size_t position = _find(key);
+			if (position == keys.size())
+				throw out_of_bounds("Tried to access key that is not in the map");
+			return vals[position];
+		}
+		iterator find(const K& key)
+		{
+			return iterator(this, _find(key));
+		}
+		const_iterator find(const K& key) const
+		{
+			return const_iterator(this, _find(key));
+		}
+		bool contains(const K& key) const
+		{
+			return _find(key) != keys.size();
+		}
+		size_t count(const K& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+		iterator lower_bound(const K& key)
+		{
+			return iterator(this, _lowerBound(key));
+		}
+		const_iterator lower_bound(const K& key) const
+		{
+			return const_iterator(this, _lowerBound(key));
+		}
+
+		size_t erase(const K& key)
+		{
+			size_t position = _find(key);
+			if (position == keys.size())
+				return 0;
+			erase(iterator(this, position));
+			return 1;
+		}
+		iterator erase(iterator position)
+		{
+			if (position.map != this)
+				throw bad_iterator("Tried to pass iterator from different map");
+			if (position.index >= keys.size())
+				throw out_of_bounds("Tried to erase end iterator");
+			_thaw();
+			keys.erase(keys.begin() + position.index);
+			vals.erase(vals.begin() + position.index);
+			return position;
+		}
+	private:
+		size_t _lowerBound(const K& key) const
+		{
+			if (!isSorted)
+				throw exception("Tried to search a map that is still being built, call freeze() first");
+			if (isFrozen)
+				return searchIndex.lowerBound(key, comp);
+			return FlatSearch::lowerBound(keys.getData(), keys.size(), key, comp);
+		}
+		bool _matches(size_t position, const K& key) const
+		{
+			return position < keys.size() && !comp(key, keys.getData()[position]);
+		}
+		size_t _find(const K& key) const
+		{
+			size_t position = _lowerBound(key);
+			return _matches(position, key) ? position : keys.size();
+		}
+		void _thaw()
+		{
+			if (isFrozen)
+			{
+				searchIndex.clear();
+				isFrozen = false;
+			}
+		}
+		//sorts the positions by key once and rebuilds both arrays in that order
+		void _ensureSorted()
+		{
+			if (isSorted)
+				return;
+			MyVector<size_t> order;
+			order.resize(keys.size());
+			for (size_t i = 0; i < order.size(); i++)
+				order[i] = i;
+			const K* sortKeys = keys.getData();
+			std::stable_sort(order.getData(), order.getData() + order.size(), [&](size_t a, size_t b) { return comp(sortKeys[a], sortKeys[b]); });
+
+			MyVector<K> sortedKeys;
+			MyVector<V> sortedVals;
+			sortedKeys.reserve(keys.size());
+			sortedVals.reserve(keys.size());
+			for (size_t i = 0; i < order.size(); i++)
+			{
+				//equal keys are next to each other in push order, only the last one stays
+				if (i + 1 < order.size() && !comp(sortKeys[order[i]], sortKeys[order[i + 1]]))
+					continue;
+				sortedKeys.push_back(std::move(keys[order[i]]));
+				sortedVals.push_back(std::move(vals[order[i]]));
+			}
+			keys.swap(sortedKeys);
+			vals.swap(sortedVals);
+			isSorted = true;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstdint>
+#include "MyVector.h"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MYSTL_FLATSEARCH_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define MYSTL_FLATSEARCH_SSE42
+#include <nmmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MySTL
+{
+	//searches over sorted keys shared by MyFlatMap and MyFlatSet
+	namespace FlatSearch
+	{
+		//index of the first element that is not less than key, or count.
+		//halves the range with a conditional move instead of a branch, so the loop runs log2(count) steps without mispredictions
+		template<typename K, typename Key, typename Comp>
+		size_t lowerBound(const K* first, size_t count, const Key& key, const Comp& comp)
+		{
+			if (count == 0)
+				return 0;
+			const K* base = first;
+			while (count > 1)
+			{
+				size_t half = count / 2;
+				base += size_t(comp(base[half - 1], key)) * half;
+				count -= half;
+			}
+			return size_t(base - first) + (comp(*base, key) ? 1 : 0);
+		}
+
+		//number of elements less than key, which is the lower bound in a short sorted run.
+		//compares every element instead of halving, the arithmetic overloads below do it several elements at a time
+		template<typename K>
+		size_t countLess(const K* first, size_t count, const K& key)
+		{
+			size_t result = 0;
+			for (size_t i = 0; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+#ifdef MYSTL_FLATSEARCH_SSE2
+		//each lane of a comparison is all ones where it holds, subtracting them counts per lane
+		inline size_t _sumLanes32(__m128i counts)
+		{
+			counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, 0x4E));
+			counts = _mm_add_epi32(counts, _mm_shuffle_epi32(counts, 0xB1));
+			return size_t(_mm_cvtsi128_si32(counts));
+		}
+		inline size_t _sumLanes64(__m128i counts)
+		{
+			alignas(16) int64_t lanes[2];
+			_mm_store_si128(reinterpret_cast<__m128i*>(lanes), counts);
+			return size_t(lanes[0] + lanes[1]);
+		}
+		inline size_t countLess(const int32_t* first, size_t count, const int32_t& key)
+		{
+			__m128i needle = _mm_set1_epi32(key);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+				counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(needle, _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i))));
+			size_t result = _sumLanes32(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+		//sse2 only compares signed integers, flipping the sign bit keeps the order of unsigned ones
+		inline size_t countLess(const uint32_t* first, size_t count, const uint32_t& key)
+		{
+			__m128i sign = _mm_set1_epi32(int32_t(0x80000000u));
+			__m128i needle = _mm_xor_si128(_mm_set1_epi32(int32_t(key)), sign);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)), sign);
+				counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(needle, values));
+			}
+			size_t result = _sumLanes32(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+		inline size_t countLess(const float* first, size_t count, const float& key)
+		{
+			__m128 needle = _mm_set1_ps(key);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+				counts = _mm_sub_epi32(counts, _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(first + i), needle)));
+			size_t result = _sumLanes32(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+		inline size_t countLess(const double* first, size_t count, const double& key)
+		{
+			__m128d needle = _mm_set1_pd(key);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+				counts = _mm_sub_epi64(counts, _mm_castpd_si128(_mm_cmplt_pd(_mm_loadu_pd(first + i), needle)));
+			size_t result = _sumLanes64(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+#endif
+#ifdef MYSTL_FLATSEARCH_SSE42
+		//64 bit integer comparisons came with sse4.2, without it the plain loop is used
+		inline size_t countLess(const int64_t* first, size_t count, const int64_t& key)
+		{
+			__m128i needle = _mm_set1_epi64x(key);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+				counts = _mm_sub_epi64(counts, _mm_cmpgt_epi64(needle, _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i))));
+			size_t result = _sumLanes64(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+		inline size_t countLess(const uint64_t* first, size_t count, const uint64_t& key)
+		{
+			__m128i sign = _mm_set1_epi64x(int64_t(0x8000000000000000ull));
+			__m128i needle = _mm_xor_si128(_mm_set1_epi64x(int64_t(key)), sign);
+			__m128i counts = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)), sign);
+				counts = _mm_sub_epi64(counts, _mm_cmpgt_epi64(needle, values));
+			}
+			size_t result = _sumLanes64(counts);
+			for (; i < count; i++)
+				result += size_t(first[i] < key);
+			return result;
+		}
+#endif
+
+		//copy of sorted keys in breadth first order of the implicit search tree, node k has the children 2k and 2k+1.
+		//the first levels that every search passes share a few cache lines instead of being spread over the whole array
+		template<typename K>
+		class EytzingerIndex
+		{
+		private:
+			MyVector<K> nodes; //1 based, nodes[0] is unused
+			MyVector<size_t> ranks; //position of every node in the sorted order
+			size_t count = 0;
+		public:
+			void build(const K* sorted, size_t n)
+			{
+				count = n;
+				nodes.resize(n + 1);
+				ranks.resize(n + 1);
+				size_t next = 0;
+				_fill(sorted, next, 1);
+			}
+			void clear()
+			{
+				nodes.clear();
+				ranks.clear();
+				count = 0;
+			}
+
+			//sorted position of the first key that is not less than key, or the number of keys
+			template<typename Key, typename Comp>
+			size_t lowerBound(const Key& key, const Comp& comp) const
+			{
+				const K* tree = nodes.getData();
+				size_t k = 1;
+				while (k <= count)
+				{
+					//the 16 great-grandchildren four levels down share one cache line for small keys, fetch it early
+					_prefetch(tree + 16 * k);
+					k = 2 * k + size_t(comp(tree[k], key));
+				}
+				//every step right after the last step left leaves a one bit behind, dropping them and the left step gives the answer
+				k >>= _trailingOnes(k) + 1;
+				return k == 0 ? count : ranks.getData()[k];
+			}
+		private:
+			//in order walk of the tree hands out the sorted keys
+			void _fill(const K* sorted, size_t& next, size_t k)
+			{
+				if (k > count)
+					return;
+				_fill(sorted, next, 2 * k);
+				nodes[k] = sorted[next];
+				ranks[k] = next++;
+				_fill(sorted, next, 2 * k + 1);
+			}
+			static void _prefetch(const K* address)
+			{
+#ifdef _MSC_VER
+				_mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#else
+				__builtin_prefetch(address);
+#endif
+			}
+			static size_t _trailingOnes(size_t k)
+			{
+#ifdef _MSC_VER
+				unsigned long bit;
+#ifdef _WIN64
+				_BitScanForward64(&bit, ~uint64_t(k));
+#else
+				_BitScanForward(&bit, ~static_cast<unsigned long>(k));
+#endif
+				return bit;
+#else
+				return __builtin_ctzll(~(unsigned long long)k);
+#endif
+			}
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include "MyVector.h"
+#include "MySpan.h"
+#include "MyFlatSearch.h"
+
+namespace MySTL
+{
+	//sorted set on a MyVector, same modes as MyFlatMap: sorted inserts, push_unsorted with a single sort in freeze(),
+	//and an Eytzinger copy of the keys for searches while frozen. iterators are plain pointers into the sorted keys
+	template<typename K, typename Comp = std::less<K>>
+	class MyFlatSet
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("FlatSet exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using key_type = K;
+		using value_type = K;
+		using iterator = const K*;
+		using const_iterator = const K*;
+	private:
+		MyVector<K> keys;
+		FlatSearch::EytzingerIndex<K> searchIndex;
+		bool isSorted = true; //false after push_unsorted until the next freeze or change
+		bool isFrozen = false; //the Eytzinger index matches the keys
+		Comp comp;
+	public:
+		MyFlatSet() = default;
+		MyFlatSet(std::initializer_list<K> list)
+		{
+			reserve(list.size());
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				push_unsorted(*it);
+			_ensureSorted();
+		}
+
+		size_t size() const
+		{
+			return keys.size();
+		}
+		bool empty() const
+		{
+			return keys.empty();
+		}
+		void reserve(size_t capacity)
+		{
+			keys.reserve(capacity);
+		}
+		void clear()
+		{
+			keys.clear();
+			searchIndex.clear();
+			isSorted = true;
+			isFrozen = false;
+		}
+		//the keys in ascending order
+		MySpan<const K> span() const
+		{
+			return MySpan<const K>(keys.getData(), keys.size());
+		}
+		const K& operator[](size_t position) const
+		{
+			if (position >= keys.size())
+				throw out_of_bounds();
+			return keys.getData()[position];
+		}
+
+		iterator begin() const
+		{
+			return keys.getData();
+		}
+		iterator end() const
+		{
+			return keys.getData() + keys.size();
+		}
+
+		//appends without keeping the order, the set can not be searched until freeze() sorted it
+		void push_unsorted(const K& key)
+		{
+			_thaw();
+			if (isSorted && !keys.empty() && !comp(keys.getData()[keys.size() - 1], key))
+				isSorted = false;
+			keys.push_back(key);
+		}
+		//sorts what was pushed unsorted and builds the Eytzinger index, searches use it until the next change
+		void freeze()
+		{
+			_ensureSorted();
+			if (!isFrozen)
+			{
+				searchIndex.build(keys.getData(), keys.size());
+				isFrozen = true;
+			}
+		}
+		bool frozen() const
+		{
+			return isFrozen;
+		}
+
+		std::pair<iterator, bool> insert(const K& key)
+		{
+			_ensureSorted();
+			size_t position = _lowerBound(key);
+			if (_matches(position, key))
+				return std::make_pair(begin() + position, false);
+			_thaw();
+			keys.insert(keys.begin() + position, key);
+			return std::make_pair(begin() + position, true);
+		}
+		//merges a range sorted by Comp in one pass over both, duplicates are dropped
+		template<class Iter>
+		void insert_sorted(Iter firstIt, Iter lastIt)
+		{
+			for (Iter previous = firstIt, it = firstIt; it != lastIt; previous = it)
+			{
+				if (++it != lastIt && comp(*it, *previous))
+					throw exception("insert_sorted needs a sorted range");
+			}
+			_ensureSorted();
+			_thaw();
+			MyVector<K> merged;
+			merged.reserve(keys.size() + std::distance(firstIt, lastIt));
+			size_t i = 0;
+			while (firstIt != lastIt || i < keys.size())
+			{
+				if (firstIt == lastIt || (i < keys.size() && !comp(*firstIt, keys[i])))
+				{
+					merged.push_back(std::move(keys[i]));
+					i++;
+				}
+				else
+				{
+					if (merged.empty() || comp(merged[merged.size() - 1], *firstIt))
+						merged.push_back(*firstIt);
+					++firstIt;
+				}
+			}
+			keys.swap(merged);
+		}
+		template<typename Range>
+		void insert_sorted(const Range& range)
+		{
+			insert_sorted(std::begin(range), std::end(range));
+		}
+
+		iterator find(const K& key) const
+		{
+			return begin() + _find(key);
+		}
+		bool contains(const K& key) const
+		{
+			return _find(key) != keys.size();
+		}
+		size_t count(const K& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+		iterator lower_bound(const K& key) const
+		{
+			return begin() + _lowerBound(key);
+		}
+
+		size_t erase(const K& key)
+		{
+			size_t position = _find(key);
+			if (position == keys.size())
+				return 0;
+			erase(begin() + position);
+			return 1;
+		}
+		iterator erase(iterator position)
+		{
+			if (position < begin() || position >= end())
+				throw out_of_bounds("Tried to erase element out of bounds");
+			size_t offset = position - begin();
+			_thaw();
+			keys.erase(keys.begin() + offset);
+			return begin() + offset;
+		}
+	private:
+		size_t _lowerBound(const K& key) const
+		{
+			if (!isSorted)
+				throw exception("Tried to search a set that is still being built, call freeze() first");
+			if (isFrozen)
+				return searchIndex.lowerBound(key, comp);
+			return FlatSearch::lowerBound(keys.getData(), keys.size(), key, comp);
+		}
+		bool _matches(size_t position, const K& key) const
+		{
+			return position < keys.size() && !comp(key, keys.getData()[position]);
+		}
+		size_t _find(const K& key) const
+		{
+			size_t position = _lowerBound(key);
+			return _matches(position, key) ? position : keys.size();
+		}
+		void _thaw()
+		{
+			if (isFrozen)
+			{
+				searchIndex.clear();
+				isFrozen = false;
+			}
+		}
+		void _ensureSorted()
+		{
+			if (isSorted)
+				return;
+			K* first = keys.getData();
+			std::sort(first, first + keys.size(), comp);
+			size_t unique = std::unique(first, first + keys.size(), [&](const K& a, const K& b) { return !comp(a, b); }) - first;
+			keys.resize(unique);
+			isSorted = true;
+		}
+	};
+}
\ No newline at end of file
@@ -3,11 +3,53 @@
 #include <exception>
 #include <initializer_list>
 #include <functional>
+#include "MyNodePool.h"
 
 namespace MySTL
 {
-	template<typename T>
-	class MyForwardList
+	//size policy of MyForwardList, keeps size() O(1) at the cost of walking the range in range splices
+	template<bool CacheSize>
+	class MyForwardListSize
+	{
+	protected:
+		size_t v_size = 0;
+
+		size_t _cachedSize() const
+		{
+			return v_size;
+		}
+		void _addSize(size_t n)
+		{
+			v_size += n;
+		}
+		void _subSize(size_t n)
+		{
+			v_size -= n;
+		}
+		void _setSize(size_t n)
+		{
+			v_size = n;
+		}
+	};
+	//size policy of MyForwardList, keeps no counter so size() has to walk the list
+	template<>
+	class MyForwardListSize<false>
+	{
+	protected:
+		size_t _cachedSize() const
+		{
+			return 0;
+		}
+		void _addSize(size_t)
+		{}
+		void _subSize(size_t)
+		{}
+		void _setSize(size_t)
+		{}
+	};
+
+	template<typename T, bool CacheSize = true>
+	class MyForwardList : private MyForwardListSize<CacheSize>
 	{
 	public:
 		class exception : public std::runtime_error
@@ -48,16 +90,23 @@ namespace MySTL
 			{}
 		};
 	private:
-		struct Node
+		//the before-begin sentinel only needs the link, so it carries no payload and lives inside the list
+		struct NodeBase
+		{
+			NodeBase* next;
+		};
+		struct Node : public NodeBase
 		{
 			T data;
-			Node* next;
-			Node(Node* next, const T& data = T())
+			//the payload is constructed in place from whatever the caller passed
+			template<typename... args>
+			Node(NodeBase* next, args&&... vals)
 				:
-				next(next),
-				data(data)
+				NodeBase{ next },
+				data(std::forward<args>(vals)...)
 			{}
 		};
+		using NodePool = MyNodePool<sizeof(Node), alignof(Node)>;
 	public:
 		class iterator
 		{
@@ -83,10 +132,10 @@ namespace MySTL
 		private:
 			friend class MyForwardList;
 
-			MyForwardList<T>* list;
-			Node* node;
+			MyForwardList* list;
+			NodeBase* node;
 		protected:
-			iterator(MyForwardList<T>* list, Node* node)
+			iterator(MyForwardList* list, NodeBase* node)
 				:
 				list(list),
 				node(node)
@@ -94,20 +143,20 @@ namespace MySTL
 		public:
 			reference operator*() const
 			{
-				if (node == list->head || node == list->tail)
+				if (node == &list->head || node == nullptr)
 					throw out_of_bounds("Tried to dereference invalid element");
-				return node->data;
+				return _value(node);
 			}
 			pointer operator->() const
 			{
-				if (node == list->head || node == list->tail)
+				if (node == &list->head || node == nullptr)
 					throw out_of_bounds("Tried to access invalid element");
-				return &node->data;
+				return &_value(node);
 			}
 
 			iterator& operator++()
 			{
-				if (node == list->tail)
+				if (node == nullptr)
 					throw out_of_bounds("Tried to advance iterator past the end of the list");
 				node = node->next;
 				return *this;
@@ -115,7 +164,7 @@ namespace MySTL
 			iterator operator++(int)
 			{
 				iterator result(*this);
-				if (node == list->tail)
+				if (node == nullptr)
 					throw out_of_bounds("Tried to advance iterator past the end of the list");
 				node = node->next;
 				return result;
@@ -140,9 +189,9 @@ namespace MySTL
 		private:
 			friend class MyForwardList;
 		protected:
-			const_iterator(const MyForwardList<T>* list, Node* node)
+			const_iterator(const MyForwardList* list, NodeBase* node)
 				:
-				iterator(const_cast<MyForwardList<T>*>(list), node)
+				iterator(const_cast<MyForwardList*>(list), node)
 			{}
 		public:
 			const iterator::reference operator*() const
@@ -156,112 +205,88 @@ namespace MySTL
 		};
 	private:
 		friend class iterator;
+		//shares the node type and pool and hands whole chains to and from lists
+		template<typename> friend class MyConcurrentStack;
 
-		Node* head; //one element before the actual beginning
-		Node* tail; //one element after the actual end
+		NodeBase head; //one element before the actual beginning, the end is marked by nullptr
+		NodeBase* last; //the last node, &head while the list is empty
 	public:
-		MyForwardList()
+		MyForwardList() noexcept
 			:
-			tail(new Node(nullptr)),
-			head(new Node(tail))
+			head{ nullptr },
+			last(&head)
 		{}
-		MyForwardList(const MyForwardList<T>& copy)
+		MyForwardList(const MyForwardList& copy)
+			:
+			MyForwardList()
 		{
-			tail = new Node(nullptr);
-			head = new Node(tail);
-			iterator mIt = before_begin();
-			for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it, ++mIt)
-			{
-				mIt.node->next = new Node(tail, *it);
-			}
+			for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
+				emplace_back(*it);
 		}
-		MyForwardList(MyForwardList<T>&& donor) noexcept //needs testing
+		MyForwardList(MyForwardList&& donor) noexcept
+			:
+			MyForwardList()
 		{
-			head = std::move(donor.head);
-			tail = std::move(donor.tail);
-			donor.head = nullptr;
-			donor.tail = nullptr;
+			_takeNodes(donor);
 		}
 		~MyForwardList()
 		{
-			_safeDeleteAllChildren(head);
+			_destroyRange(head.next, nullptr);
 		}
 
 		template<class Iter>
 		MyForwardList(Iter firstIt, Iter lastIt)
+			:
+			MyForwardList()
 		{
-			tail = new Node(nullptr);
-			head = new Node(tail);
-			iterator mIt = before_begin();
-			for (auto it = firstIt; it != lastIt; ++it, ++mIt)
-			{
-				mIt.node->next = new Node(tail, *it);
-			}
+			for (auto it = firstIt; it != lastIt; ++it)
+				emplace_back(*it);
 		}
 		MyForwardList(std::initializer_list<T> list)
+			:
+			MyForwardList()
 		{
-			tail = new Node(nullptr);
-			head = new Node(tail);
-			iterator mIt = before_begin();
-			for (auto it = list.begin(), stop = list.end(); it != stop; ++it, ++mIt)
-			{
-				mIt.node->next = new Node(tail, *it);
-			}
+			NodePool::reserve(list.size());
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				emplace_back(*it);
 		}
 		MyForwardList(size_t size, const T& val = T())
+			:
+			MyForwardList()
 		{
-			tail = new Node(nullptr);
-			head = new Node(tail);
-			iterator it = before_begin();
-			for (size_t i = 0; i < size; ++i, ++it)
-			{
-				it.node->next = new Node(tail, val);
-			}
+			NodePool::reserve(size);
+			for (size_t i = 0; i < size; i++)
+				emplace_back(val);
 		}
 
-		MyForwardList<T>& operator=(const MyForwardList<T>& copy)
+		MyForwardList& operator=(const MyForwardList& copy)
 		{
 			if (&copy != this)
 			{
-				_safeDeleteAllChildren(head);
-
-				tail = new Node(nullptr);
-				head = new Node(tail);
-				iterator mIt = before_begin();
-				for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it, ++mIt)
-				{
-					mIt.node->next = new Node(tail, *it);
-				}
+				clear();
+				for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
+					emplace_back(*it);
 			}
 
 			return *this;
 		}
-		MyForwardList<T>& operator=(MyForwardList<T>&& donor) noexcept
+		MyForwardList& operator=(MyForwardList&& donor) noexcept
 		{
 			if (&donor != this)
 			{
-				_safeDeleteAllChildren(head);
-
-				head = std::move(donor.head);
-				tail = std::move(donor.tail);
-				donor.head = nullptr;
-				donor.tail = nullptr;
+				clear();
+				_takeNodes(donor);
 			}
 			return *this;
 		}
 
-		MyForwardList<T>& operator=(std::initializer_list<T> list)
+		MyForwardList& operator=(std::initializer_list<T> list)
 		{
-			_safeDeleteAllChildren(head);
+			clear();
+			NodePool::reserve(list.size());
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				emplace_back(*it);
 
-			tail = new Node(nullptr);
-			head = new Node(tail);
-			iterator mIt = before_begin();
-			for (auto it = list.begin(), stop = list.end(); it != stop; ++it, ++mIt)
-			{
-				mIt.node->next = new Node(tail, *it);
-			}
-			
 			return *this;
 		}
 
@@ -272,19 +297,16 @@ namespace MySTL
 		void assign(size_t size, const T& val)
 		{
 			clear();
+			NodePool::reserve(size);
 			for (size_t i = 0; i < size; i++)
-			{
-				push_front(val);
-			}
+				emplace_back(val);
 		}
 		template<class Iter>
 		void assign(Iter firstIt, Iter lastIt)
 		{
 			clear();
 			for (auto it = firstIt; it != lastIt; ++it)
-			{
-				push_front(*it);
-			}
+				emplace_back(*it);
 		}
 
 		void resize(size_t n, const T& val = T())
@@ -294,102 +316,121 @@ namespace MySTL
 				clear();
 				return;
 			}
-			size_t i = 1;
-			iterator it = begin();
-			for (; i < n; ++it, i++)
-			{
-				if (it.node->next == tail)
-					break;
-			}
+			//walks from before_begin so an empty list needs no special case
+			size_t i = 0;
+			iterator it = before_begin();
+			for (; i < n && it.node->next != nullptr; i++)
+				++it;
 			if (i == n)
 			{
 				erase_after(it, end());
 				return;
 			}
-			else if (it.node->next == tail)
+			for (; i < n; i++)
 			{
-				for (; i < n; i++)
-				{
-					it = insert_after(it, val);
-				}
+				it = insert_after(it, val);
 			}
 		}
 
+		size_t size() const
+		{
+			if (CacheSize)
+				return this->_cachedSize();
+			size_t count = 0;
+			for (NodeBase* node = head.next; node != nullptr; node = node->next)
+				count++;
+			return count;
+		}
 		size_t max_size() const
 		{
 			return size_t(-1);
 		}
 		bool empty() const
 		{
-			return head->next == tail;
+			return head.next == nullptr;
 		}
 
 		T& front()
 		{
-			return head->next->data;
+			if (empty())
+				throw out_of_bounds("Cannot access element in empty list");
+			return _value(head.next);
 		}
 		const T& front() const
 		{
-			return head->next->data;
+			if (empty())
+				throw out_of_bounds("Cannot access element in empty list");
+			return _value(head.next);
+		}
+		T& back()
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _value(last);
+		}
+		const T& back() const
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _value(last);
 		}
 
 		void clear()
 		{
-			_safeDeleteAllChildren(head);
-			tail = new Node(nullptr);
-			head = new Node(tail);
+			_destroyRange(head.next, nullptr);
+			head.next = nullptr;
+			last = &head;
 		}
-		void swap(MyForwardList<T>& other)
+		void swap(MyForwardList& other) noexcept
 		{
-			Node* tempHead = head, *tempTail = tail;
-			
-			head = other.head;
-			tail = other.tail;
-
-			other.head = tempHead;
-			other.tail = tempTail;
+			NodeBase* tempFirst = head.next;
+			NodeBase* tempLast = last;
+			size_t tempSize = this->_cachedSize();
+			head.next = other.head.next;
+			last = other.empty() ? &head : other.last;
+			this->_setSize(other._cachedSize());
+			other.head.next = tempFirst;
+			other.last = tempFirst == nullptr ? &other.head : tempLast;
+			other._setSize(tempSize);
 		}
 
 		iterator before_begin()
 		{
-			return iterator(this, head);
+			return iterator(this, &head);
 		}
 		iterator begin()
 		{
-			return iterator(this, head->next);
+			return iterator(this, head.next);
+		}
+		//the last element, or before_begin() if the list is empty
+		iterator before_end()
+		{
+			return iterator(this, last);
 		}
 		iterator end()
 		{
-			return iterator(this, tail);
+			return iterator(this, nullptr);
 		}
 		const_iterator cbefore_begin() const
 		{
-			return const_iterator(this, head);
+			return const_iterator(this, const_cast<NodeBase*>(&head));
 		}
 		const_iterator cbegin() const
 		{
-			return const_iterator(this, head->next);
+			return const_iterator(this, head.next);
 		}
 		const_iterator cend() const
 		{
-			return const_iterator(this, tail);
+			return const_iterator(this, nullptr);
 		}
 
 		iterator insert_after(iterator position, const T& val)
 		{
-			_validateIteratorPtr(position, this);
-			if (position.node == tail)
-				throw out_of_bounds("Tried to insert after the end");
-			position.node->next = new Node(position.node->next, val);
-			return ++position;
+			return emplace_after(position, val);
 		}
 		iterator insert_after(iterator position, T&& val)
 		{
-			_validateIteratorPtr(position, this);
-			if (position.node == tail)
-				throw out_of_bounds("Tried to insert after the end");
-			position.node->next = new Node(position.node->next, std::move(val));
-			return ++position;
+			return emplace_after(position, std::move(val));
 		}
 		iterator insert_after(iterator position, size_t size, const T& val)
 		{
@@ -412,7 +453,7 @@ namespace MySTL
 		template<class Iter>
 		iterator insert_after(iterator position, Iter firstIt, Iter lastIt)
 		{
-			_validateIteratorPtr(position);
+			_validateIteratorPtr(position, this);
 
 			for (auto it = firstIt, stop = lastIt; it != stop; ++it)
 			{
@@ -424,22 +465,47 @@ namespace MySTL
 		template<typename... args>
 		iterator emplace_after(iterator position, args&&... vals)
 		{
-			return insert_after(position, T(vals...));
+			_validateIteratorPtr(position, this);
+			if (position.node == nullptr)
+				throw out_of_bounds("Tried to insert after the end");
+			position.node->next = _createNode(position.node->next, std::forward<args>(vals)...);
+			if (position.node == last)
+				last = position.node->next;
+			this->_addSize(1);
+			return ++position;
 		}
 		template<typename... args>
 		void emplace_front(args&&... vals)
 		{
-			head->next = new Node(head->next, std::move(vals...));
+			head.next = _createNode(head.next, std::forward<args>(vals)...);
+			if (last == &head)
+				last = head.next;
+			this->_addSize(1);
+		}
+		template<typename... args>
+		void emplace_back(args&&... vals)
+		{
+			last->next = _createNode(nullptr, std::forward<args>(vals)...);
+			last = last->next;
+			this->_addSize(1);
 		}
 
 		void push_front(const T& val)
 		{
-			head->next = new Node(head->next, val);
+			emplace_front(val);
 		}
 		void push_front(T&& val)
 		{
 			emplace_front(std::move(val));
 		}
+		void push_back(const T& val)
+		{
+			emplace_back(val);
+		}
+		void push_back(T&& val)
+		{
+			emplace_back(std::move(val));
+		}
 
 		void pop_front()
 		{
@@ -451,36 +517,41 @@ namespace MySTL
 			_validateIteratorPtr(position, this);
 			if (position.node->next == nullptr)
 				throw out_of_bounds("Tried to delete past the end of the list");
-			position.node->next = _safeDelete(position.node->next);
+			_safeDeleteNext(position.node);
 			return ++position;
 		}
+		//erases the elements between firstIt and lastIt, both exclusive
 		iterator erase_after(iterator firstIt, iterator lastIt)
 		{
 			_validateIteratorPtr(firstIt, this);
 			_validateIteratorPtr(lastIt, this);
-			if (lastIt.node == tail)
+			if (firstIt.node == nullptr)
 				throw out_of_bounds("Tried to erase_after end iterator");
 
-			iterator test = firstIt;
-			if (++test == lastIt)
+			if (firstIt.node->next == lastIt.node)
 				return lastIt;
-			Node* moveNode = firstIt.node;
-			iterator it = firstIt;
-			for (auto next = ++firstIt; next != lastIt; ++it, ++next)
-			{}
-			it.node->next = nullptr;
-			_safeDeleteAllChildren(firstIt.node);
-			moveNode->next = lastIt.node;
-			return iterator(this, moveNode);
+			_destroyRange(firstIt.node->next, lastIt.node);
+			firstIt.node->next = lastIt.node;
+			if (lastIt.node == nullptr)
+				last = firstIt.node;
+			return lastIt;
 		}
 
-		//reverse the order
+		//reverse the order by relinking the nodes
 		void reverse()
 		{
-			MyForwardList<T> newList;
-			for (auto& e : *this)
-				newList.emplace_front(std::move(e));
-			*this = newList;
+			NodeBase* reversed = nullptr;
+			NodeBase* node = head.next;
+			if (node != nullptr)
+				last = node;
+			while (node != nullptr)
+			{
+				NodeBase* next = node->next;
+				node->next = reversed;
+				reversed = node;
+				node = next;
+			}
+			head.next = reversed;
 		}
 		//bad bubble sort
 		void sort()
@@ -514,127 +585,51 @@ namespace MySTL
 			}
 		}
 		//mega big brain algorithm only partly from me
-		void merge(MyForwardList<T>& fwdlst)
+		void merge(MyForwardList& fwdlst)
 		{
-			if (empty() && !fwdlst.empty())
-			{
-				head = fwdlst.head;
-				tail = fwdlst.tail;
-				fwdlst.tail = new Node(nullptr);
-				fwdlst.head->next = fwdlst.tail;
-				return;
-			}
-			else if (fwdlst.empty())
-				return;
-
-			sort();
-			fwdlst.sort();
-
-			Node* mergedHead = nullptr;
-			Node* head1 = head->next, * head2 = fwdlst.head->next;
-			if (head1->data <= head2->data)
-			{
-				mergedHead = head1;
-				head1->next = head1->next;
-			}
-			else
-			{
-				mergedHead = head2;
-				head2 = head2->next;
-			}
-
-			Node* mergedTail = mergedHead;
-
-			while (head1 != tail && head2 != fwdlst.tail)
-			{
-				Node* temp = nullptr;
-				if (head1->data <= head2->data)
-				{
-					temp = head1;
-					head1 = head1->next;
-				}
-				else
-				{
-					temp = head2;
-					head2 = head2->next;
-				}
-				mergedTail->next = temp;
-				mergedTail = temp;
-			}
-
-			if (head1 != tail) {
-				mergedTail->next = head1;
-			}
-			else if (head2 != fwdlst.tail) {
-				mergedTail->next = head2;
-			}
-
-			head->next = mergedHead;
-			fwdlst.head->next = fwdlst.tail;
+			merge(fwdlst, [](const T& x, const T& y) { return x <= y; });
 		}
-		void merge(MyForwardList<T>&& fwdlst)
+		void merge(MyForwardList&& fwdlst)
 		{
 			merge(fwdlst);
 		}
-		void merge(MyForwardList<T>& fwdlst, std::function<bool(const T&, const T&)> Comp)
+		void merge(MyForwardList& fwdlst, std::function<bool(const T&, const T&)> Comp)
 		{
-			if (empty() && !fwdlst.empty())
+			if (fwdlst.empty() || &fwdlst == this)
+				return;
+			else if (empty())
 			{
-				head = fwdlst.head;
-				tail = fwdlst.tail;
-				fwdlst.tail = new Node(nullptr);
-				fwdlst.head->next = fwdlst.tail;
+				swap(fwdlst);
 				return;
 			}
-			else if (fwdlst.empty())
-				return;
 
 			sort(Comp);
 			fwdlst.sort(Comp);
 
-			Node* mergedHead = nullptr;
-			Node* head1 = head->next, * head2 = fwdlst.head->next;
-			if (Comp(head1->data, head2->data))
-			{
-				mergedHead = head1;
-				head1->next = head1->next;
-			}
-			else
-			{
-				mergedHead = head2;
-				head2 = head2->next;
-			}
-
-			Node* mergedTail = mergedHead;
-
-			while (head1 != tail && head2 != fwdlst.tail)
+			//link every node of fwdlst in front of the first of our nodes that it has to preceed
+			NodeBase* mergedTail = &head;
+			NodeBase* head2 = fwdlst.head.next;
+			while (head2 != nullptr)
 			{
-				Node* temp = nullptr;
-				if (Comp(head1->data, head2->data))
-				{
-					temp = head1;
-					head1 = head1->next;
-				}
-				else
+				NodeBase* head1 = mergedTail->next;
+				if (head1 == nullptr || !Comp(_value(head1), _value(head2)))
 				{
-					temp = head2;
-					head2 = head2->next;
+					NodeBase* next = head2->next;
+					head2->next = head1;
+					mergedTail->next = head2;
+					head2 = next;
 				}
-				mergedTail->next = temp;
-				mergedTail = temp;
+				mergedTail = mergedTail->next;
 			}
+			if (mergedTail->next == nullptr)
+				last = mergedTail;
 
-			if (head1 != tail) {
-				mergedTail->next = head1;
-			}
-			else if (head2 != fwdlst.tail) {
-				mergedTail->next = head2;
-			}
-
-			head->next = mergedHead;
-			fwdlst.head->next = fwdlst.tail;
+			fwdlst.head.next = nullptr;
+			fwdlst.last = &fwdlst.head;
+			this->_addSize(fwdlst._cachedSize());
+			fwdlst._setSize(0);
 		}
-		void merge(MyForwardList<T>&& fwdlst, std::function<bool(const T&, const T&)> Comp)
+		void merge(MyForwardList&& fwdlst, std::function<bool(const T&, const T&)> Comp)
 		{
 			merge(fwdlst, Comp);
 		}
@@ -643,9 +638,9 @@ namespace MySTL
 		{
 			for (auto it = before_begin(), stop = end(); it.node->next != stop.node;)
 			{
-				Node* node = it.node, *next = it.node->next;
-				if (next->data == val)
-					node->next = _safeDelete(next);
+				NodeBase* node = it.node, *next = it.node->next;
+				if (_value(next) == val)
+					_safeDeleteNext(node);
 				else
 					++it;
 			}
@@ -654,20 +649,21 @@ namespace MySTL
 		{
 			for (auto it = before_begin(), stop = end(); it.node->next != stop.node;)
 			{
-				Node* node = it.node, * next = it.node->next;
-				if (Comp(next->data))
-					node->next = _safeDelete(next);
+				NodeBase* node = it.node, * next = it.node->next;
+				if (Comp(_value(next)))
+					_safeDeleteNext(node);
 				else
 					++it;
 			}
 		}
 		//why is this called splice_after? uh, nvm
-		void splice_after(iterator position, MyForwardList<T>& fwdlst) //in work
+		//O(1), the last node of fwdlst is known
+		void splice_after(iterator position, MyForwardList& fwdlst)
 		{
 			_validateIteratorPtr(position, this);
-			if (position.node == tail)
+			if (position.node == nullptr)
 				throw out_of_bounds("Tried to insert after end of list");
-			if (fwdlst.empty())
+			if (fwdlst.empty() || &fwdlst == this)
 				return;
 			else if (empty())
 			{
@@ -675,18 +671,20 @@ namespace MySTL
 				return;
 			}
 
-			iterator it = fwdlst.before_begin();
-			for(auto stop = fwdlst.end(); it.node->next != stop.node; ++it)
-			{}
-			it.node->next = position.node->next;
-			position.node->next = fwdlst.head->next;
-			fwdlst.head->next = fwdlst.tail;
+			fwdlst.last->next = position.node->next;
+			position.node->next = fwdlst.head.next;
+			if (position.node == last)
+				last = fwdlst.last;
+			fwdlst.head.next = nullptr;
+			fwdlst.last = &fwdlst.head;
+			this->_addSize(fwdlst._cachedSize());
+			fwdlst._setSize(0);
 		}
-		void splice_after(iterator position, MyForwardList<T>&& fwdlst)
+		void splice_after(iterator position, MyForwardList&& fwdlst)
 		{
 			splice_after(position, fwdlst);
 		}
-		void splice_after(iterator position, MyForwardList<T>& fwdlst, iterator from)
+		void splice_after(iterator position, MyForwardList& fwdlst, iterator from)
 		{
 			_validateIteratorPtr(position, this);
 			_validateIteratorPtr(from, &fwdlst);
@@ -696,16 +694,22 @@ namespace MySTL
 			for(; it.node->next != from.node; ++it)
 			{}
 			it.node->next = from.node->next;
+			if (from.node == fwdlst.last)
+				fwdlst.last = it.node;
 			from.node->next = position.node->next;
 			position.node->next = from.node;
+			if (position.node == last)
+				last = from.node;
+			this->_addSize(1);
+			fwdlst._subSize(1);
 		}
-		void splice_after(iterator position, MyForwardList<T>&& fwdlst, iterator from)
+		void splice_after(iterator position, MyForwardList&& fwdlst, iterator from)
 		{
 			splice_after(position, fwdlst, from);
 		}
-		void splice_after(iterator position, MyForwardList<T>& fwdlst, iterator firstIt, iterator lastIt)
+		void splice_after(iterator position, MyForwardList& fwdlst, iterator firstIt, iterator lastIt)
 		{
-			if (position.node == tail)
+			if (position.node == nullptr)
 				throw out_of_bounds("Tried to use end iterator");
 			_validateIteratorPtr(position, this);
 			_validateIteratorPtr(firstIt, &fwdlst);
@@ -717,14 +721,22 @@ namespace MySTL
 			else if (++test == lastIt)
 				return;
 
+			//with a cached size we have to count the range, the walk to its last node is needed anyway
 			iterator it = firstIt;
-			for(; it.node->next != lastIt.node; ++it)
+			size_t count = 0;
+			for(; it.node->next != lastIt.node; ++it, count++)
 			{}
 			it.node->next = position.node->next;
 			position.node->next = firstIt.node->next;
 			firstIt.node->next = lastIt.node;
+			if (lastIt.node == nullptr)
+				fwdlst.last = firstIt.node;
+			if (position.node == last)
+				last = it.node;
+			this->_addSize(count);
+			fwdlst._subSize(count);
 		}
-		void splice_after(iterator position, MyForwardList<T>&& fwdlst, iterator firstIt, iterator lastIt)
+		void splice_after(iterator position, MyForwardList&& fwdlst, iterator firstIt, iterator lastIt)
 		{
 			splice_after(position, fwdlst, firstIt, lastIt);
 		}
@@ -732,9 +744,9 @@ namespace MySTL
 		{
 			for (auto it = begin(), itt = ++begin(), stop = end(); itt != stop;)
 			{
-				if (it.node->next->data == *it)
+				if (_value(it.node->next) == *it)
 				{
-					it.node->next = _safeDelete(it.node->next);
+					_safeDeleteNext(it.node);
 					itt.node = it.node->next;
 				}
 				else
@@ -750,7 +762,7 @@ namespace MySTL
 			{
 				if (Comp(*itt, *it))
 				{
-					it.node->next = _safeDelete(it.node->next);
+					_safeDeleteNext(it.node);
 					itt.node = it.node->next;
 				}
 				else
@@ -761,24 +773,80 @@ namespace MySTL
 			}
 		}
 	private:
-		Node* _safeDelete(Node* node)
+		static T& _value(NodeBase* node)
+		{
+			return static_cast<Node*>(node)->data;
+		}
+		template<typename... args>
+		static NodeBase* _createNode(NodeBase* next, args&&... vals)
+		{
+			void* memory = NodePool::allocate();
+			try
+			{
+				return new (memory) Node(next, std::forward<args>(vals)...);
+			}
+			catch (...)
+			{
+				NodePool::deallocate(memory);
+				throw;
+			}
+		}
+		//unlinks and destroys the node after before
+		void _safeDeleteNext(NodeBase* before)
 		{
-			Node* next = node->next;
-			delete node;
-			return next;
+			NodeBase* node = before->next;
+			before->next = node->next;
+			if (node == last)
+				last = before;
+			static_cast<Node*>(node)->~Node();
+			NodePool::deallocate(node);
+			this->_subSize(1);
 		}
-		void _safeDeleteAllChildren(Node* node)
+		//takes over a nullptr terminated chain of nodes from our pool, the list has to be empty
+		void _adoptChain(NodeBase* first) noexcept
 		{
-			Node* current = node;
-			do
+			head.next = first;
+			size_t count = 0;
+			for (NodeBase* node = first; node != nullptr; node = node->next, count++)
+				last = node;
+			this->_setSize(count);
+		}
+		//gives up all nodes, returns the first and stores the last one in lastNode
+		NodeBase* _releaseChain(NodeBase*& lastNode) noexcept
+		{
+			NodeBase* first = head.next;
+			lastNode = last;
+			head.next = nullptr;
+			last = &head;
+			this->_setSize(0);
+			return first;
+		}
+		void _takeNodes(MyForwardList& donor) noexcept
+		{
+			head.next = donor.head.next;
+			last = donor.empty() ? &head : donor.last;
+			this->_setSize(donor._cachedSize());
+			donor.head.next = nullptr;
+			donor.last = &donor.head;
+			donor._setSize(0);
+		}
+		//destroys the nodes from first up to stop in one pass and gives them back to the pool as one chain,
+		//the link in front of the range is left for the caller to patch
+		void _destroyRange(NodeBase* first, NodeBase* stop) noexcept
+		{
+			typename NodePool::FreeChain chain;
+			while (first != stop)
 			{
-				Node* next = current->next;
-				delete current;
-				current = next;
-			} while (current != nullptr);
+				NodeBase* next = first->next;
+				static_cast<Node*>(first)->~Node();
+				chain.push(first);
+				first = next;
+			}
+			this->_subSize(chain.size());
+			NodePool::deallocate(chain);
 		}
 		//check if the it points to list
-		void _validateIteratorPtr(iterator& it, MyForwardList<T>* list)
+		void _validateIteratorPtr(iterator& it, MyForwardList* list)
 		{
 			if (it.list != list)
 				throw bad_iterator("Tried to use iterator from wrong list");
@@ -0,0 +1,669 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <utility>
+#include <new>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MYSTL_HASHMAP_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MySTL
+{
+	//open addressing hash map with one control byte per slot: 0x80 for empty, otherwise 7 bits of the hash.
+	//probing is linear and compares 16 control bytes at once, so most lookups touch a single key.
+	//probes never wrap around, runs may spill into a few overflow slots behind the home range instead,
+	//which lets erase shift the rest of the run back instead of leaving tombstones
+	template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>>
+	class MyHashMap
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("HashMap exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<const K, V>;
+	private:
+		static constexpr int8_t emptyControl = -128;
+		static constexpr size_t groupWidth = 16;
+		//slots behind the home range that runs can spill into before the table has to grow
+		static constexpr size_t overflowSlots = 2 * groupWidth;
+		static constexpr size_t minCapacity = 16;
+	public:
+		class iterator
+		{
+		public:
+			using value_type = MyHashMap::value_type;
+			using reference = value_type&;
+			using pointer = value_type*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+		private:
+			class bad_iterator_compare : public exception
+			{
+			public:
+				bad_iterator_compare()
+					:
+					exception("Tried to compare one or two invalid iterators")
+				{}
+				bad_iterator_compare(const char* msg)
+					:
+					exception(msg)
+				{}
+			};
+		protected:
+			friend class MyHashMap;
+
+			MyHashMap* map;
+			size_t index;
+
+			iterator(MyHashMap* map, size_t index)
+				:
+				map(map),
+				index(index)
+			{}
+		public:
+			reference operator*() const
+			{
+				if (index >= map->slotCount)
+					throw out_of_bounds("Tried to dereference end iterator");
+				return map->slots[index];
+			}
+			pointer operator->() const
+			{
+				return &**this;
+			}
+
+			iterator& operator++()
+			{
+				if (index >= map->slotCount)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				index = map->_nextFull(index + 1);
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+
+			bool operator==(const iterator& other) const
+			{
+				if (map != other.map)
+					throw bad_iterator_compare("Tried to compare iterators of different maps");
+				return index == other.index;
+			}
+			bool operator!=(const iterator& other) const
+			{
+				return !(*this == other);
+			}
+		};
+		class const_iterator : public iterator
+		{
+		private:
+			friend class MyHashMap;
+		protected:
+			const_iterator(const MyHashMap* map, size_t index)
+				:
+				iterator(const_cast<MyHashMap*>(map), index)
+			{}
+		public:
+			const value_type& operator*() const
+			{
+				return iterator::operator*();
+			}
+			const value_type* operator->() const
+			{
+				return iterator::operator->();
+			}
+		};
+	private:
+		friend class iterator;
+
+		int8_t* control; //slotCount control bytes, then groupWidth empty ones so group loads never run off the end
+		value_type* slots; //uninitialized wherever the control byte is empty
+		size_t capacity; //size of the home range, a power of two
+		size_t slotCount; //capacity plus overflowSlots
+		size_t v_size;
+		Hash hasher;
+		Eq equal;
+	public:
+		MyHashMap()
+			:
+			control(_emptyTable()),
+			slots(nullptr),
+			capacity(0),
+			slotCount(0),
+			v_size(0)
+		{}
+		MyHashMap(std::initializer_list<value_type> list)
+			:
+			MyHashMap()
+		{
+			reserve(list.size());
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				insert(*it);
+		}
+		MyHashMap(const MyHashMap& copy)
+			:
+			control(_emptyTable()),
+			slots(nullptr),
+			capacity(0),
+			slotCount(0),
+			v_size(0),
+			hasher(copy.hasher),
+			equal(copy.equal)
+		{
+			_copyFrom(copy);
+		}
+		MyHashMap(MyHashMap&& donor) noexcept
+			:
+			MyHashMap()
+		{
+			swap(donor);
+		}
+		~MyHashMap()
+		{
+			_destroyTable();
+		}
+
+		MyHashMap& operator=(const MyHashMap& copy)
+		{
+			if (&copy != this)
+			{
+				clear();
+				_copyFrom(copy);
+			}
+			return *this;
+		}
+		MyHashMap& operator=(MyHashMap&& donor) noexcept
+		{
+			if (&donor != this)
+			{
+				MyHashMap temp(std::move(donor));
+				swap(temp);
+			}
+			return *this;
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		//number of slots, including the overflow slots behind the home range
+		size_t bucket_count() const
+		{
+			return slotCount;
+		}
+		//how many elements fit before the next rehash
+		size_t max_load() const
+		{
+			return _maxLoad(capacity);
+		}
+		//makes room for count elements, so inserting up to count elements does not rehash
+		void reserve(size_t count)
+		{
+			size_t newCapacity = minCapacity;
+			while (_maxLoad(newCapacity) < count)
+				newCapacity *= 2;
+			if (newCapacity > capacity)
+				_rehash(newCapacity);
+		}
+		void clear()
+		{
+			for (size_t i = 0; i < slotCount; i++)
+			{
+				if (control[i] != emptyControl)
+				{
+					slots[i].~value_type();
+					control[i] = emptyControl;
+				}
+			}
+			v_size = 0;
+		}
+		void swap(MyHashMap& other) noexcept
+		{
+			std::swap(control, other.control);
+			std::swap(slots, other.slots);
+			std::swap(capacity, other.capacity);
+			std::swap(slotCount, other.slotCount);
+			std::swap(v_size, other.v_size);
+			std::swap(hasher, other.hasher);
+			std::swap(equal, other.equal);
+		}
+
+		iterator begin()
+		{
+			return iterator(this, _nextFull(0));
+		}
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, _nextFull(0));
+		}
+		iterator end()
+		{
+			return iterator(this, slotCount);
+		}
+		const_iterator end() const
+		{
+			return cend();
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, slotCount);
+		}
+
+		std::pair<iterator, bool> insert(const value_type& val)
+		{
+			return try_emplace(val.first, val.second);
+		}
+		std::pair<iterator, bool> insert(value_type&& val)
+		{
+			return try_emplace(val.first, std::move(val.second));
+		}
+		//constructs the value from vals only if key is not in the map yet
+		template<typename KeyArg, typename... args>
+		std::pair<iterator, bool> try_emplace(KeyArg&& key, args&&... vals)
+		{
+			size_t hash = _hash(key);
+			size_t found = _find(key, hash);
+			if (found != slotCount)
+				return std::make_pair(iterator(this, found), false);
+			size_t index = _prepareInsert(hash);
+			new (&slots[index]) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<args>(vals)...));
+			control[index] = _h2(hash);
+			v_size++;
+			return std::make_pair(iterator(this, index), true);
+		}
+		template<typename KeyArg, typename Val>
+		std::pair<iterator, bool> insert_or_assign(KeyArg&& key, Val&& val)
+		{
+			std::pair<iterator, bool> result = try_emplace(std::forward<KeyArg>(key), std::forward<Val>(val));
+			if (!result.second)
+				result.first->second = std::forward<Val>(val);
+			return result;
+		}
+		V& operator[](const K& key)
+		{
+			return try_emplace(key).first->second;
+		}
+		V& operator[](K&& key)
+		{
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		//lookups take any type Hash and Eq accept when both declare is_transparent, otherwise only K
+		V& at(const K& key)
+		{
+			return _at(key);
+		}
+		const V& at(const K& key) const
+		{
+			return const_cast<MyHashMap*>(this)->_at(key);
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		V& at(const Key& key)
+		{
+			return _at(key);
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		const V& at(const Key& key) const
+		{
+			return const_cast<MyHashMap*>(this)->_at(key);
+		}
+
+		iterator find(const K& key)
+		{
+			return iterator(this, _find(key, _hash(key)));
+		}
+		const_iterator find(const K& key) const
+		{
+			return const_iterator(this, _find(key, _hash(key)));
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		iterator find(const Key& key)
+		{
+			return iterator(this, _find(key, _hash(key)));
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		const_iterator find(const Key& key) const
+		{
+			return const_iterator(this, _find(key, _hash(key)));
+		}
+
+		bool contains(const K& key) const
+		{
+			return _find(key, _hash(key)) != slotCount;
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		bool contains(const Key& key) const
+		{
+			return _find(key, _hash(key)) != slotCount;
+		}
+		size_t count(const K& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		size_t count(const Key& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+
+		//returns the iterator to the element after the erased one, iteration with erase visits every element exactly once
+		iterator erase(iterator position)
+		{
+			if (position.map != this)
+				throw bad_iterator("Tried to pass iterator from different map");
+			if (position.index >= slotCount)
+				throw out_of_bounds("Tried to erase end iterator");
+			_eraseAt(position.index);
+			//later elements of the run may have been shifted into the erased slot
+			return iterator(this, _nextFull(position.index));
+		}
+		size_t erase(const K& key)
+		{
+			return _eraseKey(key);
+		}
+		template<typename Key, typename H = Hash, typename E = Eq, typename = typename H::is_transparent, typename = typename E::is_transparent>
+		size_t erase(const Key& key)
+		{
+			return _eraseKey(key);
+		}
+	private:
+		//shared by every map that has not allocated yet, a full group of empty control bytes
+		static int8_t* _emptyTable()
+		{
+			alignas(16) static int8_t table[groupWidth] = { emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl,
+				emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl, emptyControl };
+			return table;
+		}
+		static size_t _maxLoad(size_t capacity)
+		{
+			//linear probing gets slow quickly above three quarters
+			return capacity - capacity / 4;
+		}
+		template<typename Key>
+		size_t _hash(const Key& key) const
+		{
+			//multiplicative mixing, so identity hashes of nearby integers still spread over the table
+			uint64_t mixed = uint64_t(hasher(key)) * 0x9E3779B97F4A7C15ull;
+			return size_t(mixed ^ (mixed >> 32));
+		}
+		//the control byte, the low 7 bits of the hash
+		static int8_t _h2(size_t hash)
+		{
+			return int8_t(hash & 0x7F);
+		}
+		//the home slot, from the high bits of the hash
+		size_t _home(size_t hash) const
+		{
+			return (hash >> 7) & (capacity - 1);
+		}
+
+		//bitmask of the control bytes in the group at position that equal h2
+		uint32_t _match(size_t position, int8_t h2) const
+		{
+#ifdef MYSTL_HASHMAP_SSE2
+			__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control + position));
+			return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2))));
+#else
+			uint32_t mask = 0;
+			for (size_t i = 0; i < groupWidth; i++)
+				mask |= uint32_t(control[position + i] == h2) << i;
+			return mask;
+#endif
+		}
+		//bitmask of the empty control bytes in the group at position, empty is the only state with the high bit set
+		uint32_t _empties(size_t position) const
+		{
+#ifdef MYSTL_HASHMAP_SSE2
+			return uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control + position))));
+#else
+			uint32_t mask = 0;
+			for (size_t i = 0; i < groupWidth; i++)
+				mask |= uint32_t(control[position + i] == emptyControl) << i;
+			return mask;
+#endif
+		}
+		static size_t _lowestBit(uint32_t mask)
+		{
+#ifdef _MSC_VER
+			unsigned long bit;
+			_BitScanForward(&bit, mask);
+			return bit;
+#else
+			return __builtin_ctz(mask);
+#endif
+		}
+
+		//slot of key or slotCount, the run starting at the home slot ends at the first empty slot
+		template<typename Key>
+		size_t _find(const Key& key, size_t hash) const
+		{
+			if (capacity == 0)
+				return slotCount;
+			int8_t h2 = _h2(hash);
+			for (size_t position = _home(hash); position < slotCount; position += groupWidth)
+			{
+				uint32_t empties = _empties(position);
+				//matches behind the first empty slot belong to other runs
+				uint32_t candidates = _match(position, h2) & (empties == 0 ? 0xFFFF : (empties & (0 - empties)) - 1);
+				while (candidates != 0)
+				{
+					size_t index = position + _lowestBit(candidates);
+					if (equal(slots[index].first, key))
+						return index;
+					candidates &= candidates - 1;
+				}
+				if (empties != 0)
+					break;
+			}
+			return slotCount;
+		}
+		template<typename Key>
+		V& _at(const Key& key)
+		{
+			size_t index = _find(key, _hash(key));
+			if (index == slotCount)
+				throw out_of_bounds("Tried to access key that is not in the map");
+			return slots[index].second;
+		}
+		//first empty slot of the run of hash, grows the table when it is too full or the run would leave the overflow slots
+		size_t _prepareInsert(size_t hash)
+		{
+			if (v_size + 1 > _maxLoad(capacity))
+				_rehash(capacity == 0 ? minCapacity : capacity * 2);
+			while (true)
+			{
+				size_t index = _firstEmpty(hash);
+				if (index < slotCount)
+					return index;
+				_rehash(capacity * 2);
+			}
+		}
+		size_t _firstEmpty(size_t hash) const
+		{
+			for (size_t position = _home(hash); position < slotCount; position += groupWidth)
+			{
+				uint32_t empties = _empties(position);
+				if (empties != 0)
+					return position + _lowestBit(empties);
+			}
+			return slotCount;
+		}
+		size_t _nextFull(size_t index) const
+		{
+			for (; index < slotCount; index += groupWidth)
+			{
+				uint32_t full = ~_empties(index) & 0xFFFF;
+				if (full != 0)
+					return index + _lowestBit(full);
+			}
+			return slotCount;
+		}
+
+		template<typename Key>
+		size_t _eraseKey(const Key& key)
+		{
+			size_t index = _find(key, _hash(key));
+			if (index == slotCount)
+				return 0;
+			_eraseAt(index);
+			return 1;
+		}
+		//backward shift: every later element of the run whose home is at or before the hole moves into it,
+		//the run stays without gaps and no tombstone is needed. runs never wrap, so elements only move towards the front
+		void _eraseAt(size_t hole)
+		{
+			slots[hole].~value_type();
+			control[hole] = emptyControl;
+			v_size--;
+			for (size_t index = hole + 1; index < slotCount && control[index] != emptyControl; index++)
+			{
+				if (_home(_hash(slots[index].first)) <= hole)
+				{
+					new (&slots[hole]) value_type(std::move(_mutable(slots[index])));
+					slots[index].~value_type();
+					control[hole] = control[index];
+					control[index] = emptyControl;
+					hole = index;
+				}
+			}
+		}
+		//the stored pairs are only ever moved as a whole while they are not reachable,
+		//viewing the key as non const for that avoids copying it
+		static std::pair<K, V>& _mutable(value_type& val)
+		{
+			return reinterpret_cast<std::pair<K, V>&>(val);
+		}
+
+		void _rehash(size_t newCapacity)
+		{
+			int8_t* oldControl = control;
+			value_type* oldSlots = slots;
+			size_t oldSlotCount = slotCount;
+			_allocate(newCapacity);
+			_moveFrom(oldControl, oldSlots, oldSlotCount);
+		}
+		//switches to an empty table of newCapacity, the members only change once both arrays are allocated
+		void _allocate(size_t newCapacity)
+		{
+			size_t newSlotCount = newCapacity + overflowSlots;
+			int8_t* newControl = new int8_t[newSlotCount + groupWidth];
+			value_type* newSlots;
+			try
+			{
+				newSlots = static_cast<value_type*>(::operator new(sizeof(value_type) * newSlotCount));
+			}
+			catch (...)
+			{
+				delete[] newControl;
+				throw;
+			}
+			std::memset(newControl, emptyControl, newSlotCount + groupWidth);
+			capacity = newCapacity;
+			slotCount = newSlotCount;
+			control = newControl;
+			slots = newSlots;
+		}
+		//moves every element of the old table into the current one and frees the old table
+		void _moveFrom(int8_t* oldControl, value_type* oldSlots, size_t oldSlotCount)
+		{
+			for (size_t i = 0; i < oldSlotCount; i++)
+			{
+				if (oldControl[i] == emptyControl)
+					continue;
+				size_t hash = _hash(oldSlots[i].first);
+				size_t index;
+				while ((index = _firstEmpty(hash)) == slotCount)
+				{
+					//a pathological run, move what already arrived into a table twice the size and go on there
+					int8_t* partialControl = control;
+					value_type* partialSlots = slots;
+					size_t partialSlotCount = slotCount;
+					_allocate(capacity * 2);
+					_moveFrom(partialControl, partialSlots, partialSlotCount);
+				}
+				new (&slots[index]) value_type(std::move(_mutable(oldSlots[i])));
+				oldSlots[i].~value_type();
+				control[index] = _h2(hash);
+			}
+			if (oldSlotCount != 0)
+			{
+				delete[] oldControl;
+				::operator delete(oldSlots);
+			}
+		}
+
+		void _copyFrom(const MyHashMap& copy)
+		{
+			reserve(copy.v_size);
+			for (size_t i = 0; i < copy.slotCount; i++)
+			{
+				if (copy.control[i] != emptyControl)
+					insert(copy.slots[i]);
+			}
+		}
+		void _destroyTable()
+		{
+			if (slotCount == 0)
+				return;
+			clear();
+			delete[] control;
+			::operator delete(slots);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//hazard pointers for the lock-free containers. a thread publishes the nodes it is about to read in its slots,
+	//removed nodes are retired instead of freed and only reclaimed once no slot of any thread points at them
+	class MyHazardPointers
+	{
+	public:
+		static constexpr size_t slotsPerThread = 2;
+	private:
+		//one record per thread that ever used hazard pointers, records are reused by later threads but never freed
+		struct Record
+		{
+			std::atomic<void*> slots[slotsPerThread];
+			std::atomic<bool> active;
+			Record* next;
+		};
+		struct Retired
+		{
+			void* node;
+			void (*reclaim)(void*);
+		};
+		//the per thread part, hands its record back and its leftovers to the other threads when the thread exits
+		struct ThreadState
+		{
+			Record* record = _acquireRecord();
+			MyVector<Retired> retired;
+
+			~ThreadState()
+			{
+				for (size_t i = 0; i < slotsPerThread; i++)
+					record->slots[i].store(nullptr);
+				record->active.store(false, std::memory_order_release);
+				_scan(*this);
+				if (retired.empty())
+					return;
+				std::lock_guard<std::mutex> lock(_orphanMutex());
+				MyVector<Retired>& orphans = _orphans();
+				for (size_t i = 0; i < retired.size(); i++)
+					orphans.push_back(retired[i]);
+				_orphanCount().store(orphans.size(), std::memory_order_release);
+			}
+		};
+	public:
+		//publish the pointer currently stored in source in slot and return it,
+		//reloads until the published pointer is still the one in source so it cannot have been retired before
+		template<typename Ptr>
+		static Ptr* protect(size_t slot, const std::atomic<Ptr*>& source)
+		{
+			std::atomic<void*>& hazard = _state().record->slots[slot];
+			Ptr* ptr = source.load(std::memory_order_relaxed);
+			while (true)
+			{
+				hazard.store(ptr);
+				Ptr* check = source.load();
+				if (check == ptr)
+					return ptr;
+				ptr = check;
+			}
+		}
+		//publish ptr without validation, the caller has to check afterwards that ptr is still reachable
+		static void set(size_t slot, void* ptr)
+		{
+			_state().record->slots[slot].store(ptr);
+		}
+		static void clear(size_t slot)
+		{
+			_state().record->slots[slot].store(nullptr, std::memory_order_release);
+		}
+		//hand a node that is no longer reachable to the reclamation, reclaim is called once no thread protects it
+		static void retire(void* node, void (*reclaim)(void*))
+		{
+			ThreadState& state = _state();
+			state.retired.push_back(Retired{ node, reclaim });
+			if (state.retired.size() >= _scanThreshold())
+				_scan(state);
+		}
+		//blocks until no slot holds a node of the chain starting at first. for nodes that were unlinked without being retired
+		//because their new owner frees them directly, a thread that protected one of them before the unlink fails its
+		//validation afterwards and clears or moves its slot, so the wait is short
+		template<typename Node>
+		static void waitUntilUnprotected(Node* first)
+		{
+			MyVector<void*> hazards;
+			while (true)
+			{
+				_collectHazards(hazards);
+				void** begin = hazards.getData();
+				void** end = begin + hazards.size();
+				bool inUse = false;
+				for (Node* node = first; node != nullptr && !inUse; node = node->next)
+					inUse = std::binary_search(begin, end, static_cast<void*>(node));
+				if (!inUse)
+					return;
+				std::this_thread::yield();
+			}
+		}
+	private:
+		static ThreadState& _state()
+		{
+			thread_local ThreadState state;
+			return state;
+		}
+		static std::atomic<Record*>& _records()
+		{
+			static std::atomic<Record*> records(nullptr);
+			return records;
+		}
+		static std::atomic<size_t>& _recordCount()
+		{
+			static std::atomic<size_t> count(0);
+			return count;
+		}
+		static std::mutex& _orphanMutex()
+		{
+			static std::mutex mutex;
+			return mutex;
+		}
+		static MyVector<Retired>& _orphans()
+		{
+			static MyVector<Retired> orphans;
+			return orphans;
+		}
+		static std::atomic<size_t>& _orphanCount()
+		{
+			static std::atomic<size_t> count(0);
+			return count;
+		}
+		//scanning is O(retired + hazards), so it is only worth it once there are clearly more retired nodes than hazards
+		static size_t _scanThreshold()
+		{
+			size_t hazards = _recordCount().load(std::memory_order_relaxed) * slotsPerThread;
+			return hazards * 2 > 64 ? hazards * 2 : 64;
+		}
+		static Record* _acquireRecord()
+		{
+			for (Record* record = _records().load(std::memory_order_acquire); record != nullptr; record = record->next)
+			{
+				bool active = false;
+				if (!record->active.load(std::memory_order_relaxed) && record->active.compare_exchange_strong(active, true))
+					return record;
+			}
+
+			Record* record = new Record;
+			for (size_t i = 0; i < slotsPerThread; i++)
+				record->slots[i].store(nullptr, std::memory_order_relaxed);
+			record->active.store(true, std::memory_order_relaxed);
+			record->next = _records().load(std::memory_order_relaxed);
+			while (!_records().compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+			{}
+			_recordCount().fetch_add(1, std::memory_order_relaxed);
+			return record;
+		}
+		//every pointer currently published in a slot of any thread, sorted
+		static void _collectHazards(MyVector<void*>& hazards)
+		{
+			hazards.resize(0);
+			hazards.reserve(_recordCount().load(std::memory_order_relaxed) * slotsPerThread);
+			for (Record* record = _records().load(std::memory_order_acquire); record != nullptr; record = record->next)
+			{
+				for (size_t i = 0; i < slotsPerThread; i++)
+				{
+					void* hazard = record->slots[i].load();
+					if (hazard != nullptr)
+						hazards.push_back(hazard);
+				}
+			}
+			std::sort(hazards.getData(), hazards.getData() + hazards.size());
+		}
+		//reclaim every retired node of this thread that is not in any slot, keep the rest for the next scan
+		static void _scan(ThreadState& state)
+		{
+			if (_orphanCount().load(std::memory_order_acquire) != 0)
+			{
+				std::lock_guard<std::mutex> lock(_orphanMutex());
+				MyVector<Retired>& orphans = _orphans();
+				for (size_t i = 0; i < orphans.size(); i++)
+					state.retired.push_back(orphans[i]);
+				orphans.resize(0);
+				_orphanCount().store(0, std::memory_order_relaxed);
+			}
+
+			MyVector<void*> hazards;
+			_collectHazards(hazards);
+			void** first = hazards.getData();
+			void** last = first + hazards.size();
+
+			MyVector<Retired>& retired = state.retired;
+			size_t kept = 0;
+			for (size_t i = 0; i < retired.size(); i++)
+			{
+				if (std::binary_search(first, last, retired[i].node))
+					retired[kept++] = retired[i];
+				else
+					retired[i].reclaim(retired[i].node);
+			}
+			retired.resize(kept);
+		}
+	};
+}
\ No newline at end of file
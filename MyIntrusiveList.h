@@ -0,0 +1,630 @@
+#pragma once
+
+#include <stdexcept>
+#include <functional>
+
+namespace MySTL
+{
+	//the links an object needs to be put into a MyIntrusiveList, an unlinked hook has all of them set to nullptr
+	class MyListHook
+	{
+	private:
+		template<typename T, MyListHook T::* Hook>
+		friend class MyIntrusiveList;
+
+		MyListHook* prev;
+		MyListHook* next;
+		const void* owner; //the list the hook is linked into, so a list can refuse objects of other lists
+	public:
+		MyListHook() noexcept
+			:
+			prev(nullptr),
+			next(nullptr),
+			owner(nullptr)
+		{}
+		//copying an object does not copy its membership in a list
+		MyListHook(const MyListHook&) noexcept
+			:
+			MyListHook()
+		{}
+		MyListHook& operator=(const MyListHook&) noexcept
+		{
+			return *this;
+		}
+
+		bool is_linked() const
+		{
+			return next != nullptr;
+		}
+	};
+
+	//a doubly linked list that links objects through their own MyListHook member, it never allocates or copies
+	//and does not own the objects, they have to outlive their membership in the list.
+	//every hook knows its list, so moving and splicing whole lists walks the moved objects to update that
+	template<typename T, MyListHook T::* Hook>
+	class MyIntrusiveList
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		public:
+			exception()
+				:
+				exception("IntrusiveList exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* message)
+				:
+				exception(message)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* message)
+				:
+				exception(message)
+			{}
+		};
+	public:
+		class iterator
+		{
+		public:
+			using value_type = T;
+			using reference = T&;
+			using pointer = T*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::bidirectional_iterator_tag;
+		public:
+			class bad_iterator_compare : public exception
+			{
+			public:
+				bad_iterator_compare()
+					:
+					exception("Tried to compare false iterators")
+				{}
+				bad_iterator_compare(const char* message)
+					:
+					exception(message)
+				{}
+			};
+		private:
+			friend class MyIntrusiveList;
+
+			MyIntrusiveList* list;
+			MyListHook* node;
+		protected:
+			iterator(MyIntrusiveList* list, MyListHook* node)
+				:
+				list(list),
+				node(node)
+			{}
+		public:
+			reference operator*() const
+			{
+				if (node == &list->head || node == &list->tail)
+					throw out_of_bounds("Tried to dereference invalid element");
+				return *_object(node);
+			}
+			pointer operator->() const
+			{
+				if (node == &list->head || node == &list->tail)
+					throw out_of_bounds("Tried to access invalid element");
+				return _object(node);
+			}
+
+			iterator& operator++()
+			{
+				if (node == &list->tail)
+					throw out_of_bounds("Tried to increment iterator out of bounds");
+				node = node->next;
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator& operator--()
+			{
+				if (node->prev == &list->head)
+					throw out_of_bounds("Tried to decrement iterator out of bounds");
+				node = node->prev;
+				return *this;
+			}
+			iterator operator--(int)
+			{
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator& other) const
+			{
+				if (list == other.list)
+					return node == other.node;
+				else
+					throw bad_iterator_compare("Tried to compare iterators from different lists");
+			}
+			bool operator!=(const iterator& other) const
+			{
+				if (list == other.list)
+					return node != other.node;
+				else
+					throw bad_iterator_compare("Tried to compare iterators from different lists");
+			}
+		};
+		class const_iterator : public iterator
+		{
+		private:
+			friend class MyIntrusiveList;
+		protected:
+			const_iterator(const MyIntrusiveList* list, MyListHook* node)
+				:
+				iterator(const_cast<MyIntrusiveList*>(list), node)
+			{}
+		public:
+			const T& operator*() const
+			{
+				return iterator::operator*();
+			}
+			const T* operator->() const
+			{
+				return iterator::operator->();
+			}
+		};
+		class reverse_iterator : public iterator
+		{
+		private:
+			friend class MyIntrusiveList;
+		protected:
+			reverse_iterator(MyIntrusiveList* list, MyListHook* node)
+				:
+				iterator(list, node)
+			{}
+		public:
+			reverse_iterator& operator++()
+			{
+				if (iterator::node == &iterator::list->head)
+					throw out_of_bounds("Tried to increment reverse iterator past the reverse end");
+				iterator::node = iterator::node->prev;
+				return *this;
+			}
+			reverse_iterator operator++(int)
+			{
+				reverse_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			reverse_iterator& operator--()
+			{
+				if (iterator::node->next == &iterator::list->tail)
+					throw out_of_bounds("Tried to decrement reverse iterator past the reverse begin");
+				iterator::node = iterator::node->next;
+				return *this;
+			}
+			reverse_iterator operator--(int)
+			{
+				reverse_iterator result(*this);
+				--(*this);
+				return result;
+			}
+		};
+		class const_reverse_iterator : public reverse_iterator
+		{
+		private:
+			friend class MyIntrusiveList;
+		protected:
+			const_reverse_iterator(const MyIntrusiveList* list, MyListHook* node)
+				:
+				reverse_iterator(const_cast<MyIntrusiveList*>(list), node)
+			{}
+		public:
+			const T& operator*() const
+			{
+				return reverse_iterator::operator*();
+			}
+			const T* operator->() const
+			{
+				return reverse_iterator::operator->();
+			}
+		};
+	private:
+		friend class iterator;
+
+		MyListHook head; //one element before the first
+		MyListHook tail; //one element after the last
+		size_t v_size;
+	public:
+		MyIntrusiveList() noexcept
+			:
+			v_size(0)
+		{
+			head.next = &tail;
+			tail.prev = &head;
+		}
+		//an object can only be linked into one list at a time, so lists can only be moved
+		MyIntrusiveList(const MyIntrusiveList&) = delete;
+		MyIntrusiveList(MyIntrusiveList&& donor) noexcept
+			:
+			MyIntrusiveList()
+		{
+			_takeNodes(donor);
+		}
+		~MyIntrusiveList()
+		{
+			clear();
+		}
+
+		MyIntrusiveList& operator=(const MyIntrusiveList&) = delete;
+		MyIntrusiveList& operator=(MyIntrusiveList&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				clear();
+				_takeNodes(donor);
+			}
+			return *this;
+		}
+
+		void swap(MyIntrusiveList& list) noexcept
+		{
+			MyIntrusiveList temp(std::move(list));
+			list._takeNodes(*this);
+			_takeNodes(temp);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		size_t max_size() const
+		{
+			return size_t(-1);
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+
+		//unlinks all objects, the objects themselves are left untouched
+		void clear() noexcept
+		{
+			MyListHook* node = head.next;
+			while (node != &tail)
+			{
+				MyListHook* next = node->next;
+				node->prev = nullptr;
+				node->next = nullptr;
+				node->owner = nullptr;
+				node = next;
+			}
+			head.next = &tail;
+			tail.prev = &head;
+			v_size = 0;
+		}
+
+		T& front()
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return *_object(head.next);
+		}
+		const T& front() const
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return *_object(head.next);
+		}
+		T& back()
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return *_object(tail.prev);
+		}
+		const T& back() const
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return *_object(tail.prev);
+		}
+
+		iterator begin()
+		{
+			return iterator(this, head.next);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, head.next);
+		}
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(this, tail.prev);
+		}
+		const_reverse_iterator crbegin() const
+		{
+			return const_reverse_iterator(this, tail.prev);
+		}
+		iterator end()
+		{
+			return iterator(this, &tail);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, const_cast<MyListHook*>(&tail));
+		}
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this, &head);
+		}
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(this, const_cast<MyListHook*>(&head));
+		}
+
+		//get an iterator to an object that is linked into this list in O(1)
+		iterator iterator_to(T& object)
+		{
+			MyListHook* node = &(object.*Hook);
+			if (!node->is_linked())
+				throw bad_iterator("Tried to get iterator to unlinked object");
+			if (node->owner != this)
+				throw bad_iterator("Tried to get iterator to object of other list");
+			return iterator(this, node);
+		}
+
+		iterator insert(iterator position, T& object)
+		{
+			_validateIterator(position);
+			MyListHook* node = &(object.*Hook);
+			if (node->is_linked())
+				throw exception("Tried to insert object that is already linked into a list");
+			_hookOffset(&object);
+			_link(position.node, node);
+			v_size++;
+			return iterator(this, node);
+		}
+		template<class Iter>
+		iterator insert(iterator position, Iter firstIt, Iter lastIt)
+		{
+			_validateIterator(position);
+			iterator ret = position;
+			bool first = true;
+			for (auto it = firstIt; it != lastIt; ++it)
+			{
+				iterator inserted = insert(position, *it);
+				if (first)
+				{
+					ret = inserted;
+					first = false;
+				}
+			}
+			return ret;
+		}
+
+		void push_back(T& object)
+		{
+			insert(end(), object);
+		}
+		void push_front(T& object)
+		{
+			insert(begin(), object);
+		}
+
+		void pop_back()
+		{
+			if (empty())
+				throw exception("Cannot pop element from empty list");
+			_unlink(tail.prev);
+		}
+		void pop_front()
+		{
+			if (empty())
+				throw exception("Cannot pop element from empty list");
+			_unlink(head.next);
+		}
+
+		void erase(iterator position)
+		{
+			if (position.node == &head || position.node == &tail)
+				throw out_of_bounds("Tried to delete element out of bounds");
+			_validateIterator(position);
+			_unlink(position.node);
+		}
+		iterator erase(iterator firstIt, iterator lastIt)
+		{
+			_validateIterator(firstIt);
+			_validateIterator(lastIt);
+			while (firstIt != lastIt)
+			{
+				MyListHook* node = firstIt.node;
+				++firstIt;
+				_unlink(node);
+			}
+			return lastIt;
+		}
+		//unlink an object from this list in O(1), does nothing if it is not linked,
+		//an object linked into another list must be unlinked through that list and throws bad_iterator here
+		void unlink(T* object)
+		{
+			MyListHook* node = &(object->*Hook);
+			if (!node->is_linked())
+				return;
+			if (node->owner != this)
+				throw bad_iterator("Tried to unlink object of other list");
+			_unlink(node);
+		}
+
+		void splice(iterator position, MyIntrusiveList& list)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_validateIterator(position);
+			for (MyListHook* node = list.head.next; node != &list.tail; node = node->next)
+				node->owner = this;
+			list.tail.prev->next = position.node;
+			list.head.next->prev = position.node->prev;
+			position.node->prev->next = list.head.next;
+			position.node->prev = list.tail.prev;
+			list.head.next = &list.tail;
+			list.tail.prev = &list.head;
+			v_size += list.v_size;
+			list.v_size = 0;
+		}
+		void splice(iterator position, MyIntrusiveList&& list)
+		{
+			splice(position, list);
+		}
+		//unlike MyList this also works inside of one list, which makes moving an object to the front O(1)
+		void splice(iterator position, MyIntrusiveList& list, iterator from)
+		{
+			_validateIterator(position);
+			_validateIterator(from, &list);
+			if (from.node == &list.head || from.node == &list.tail)
+				throw out_of_bounds("Tried to splice element out of bounds");
+			if (position.node == from.node || position.node->prev == from.node)
+				return;
+			list._unlink(from.node);
+			_link(position.node, from.node);
+			v_size++;
+		}
+		void splice(iterator position, MyIntrusiveList&& list, iterator from)
+		{
+			splice(position, list, from);
+		}
+		void splice(iterator position, MyIntrusiveList& list, iterator firstIt, iterator lastIt)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_validateIterator(position);
+			_validateIterator(firstIt, &list);
+			_validateIterator(lastIt, &list);
+			if (firstIt == lastIt)
+				return;
+			size_t count = 0;
+			for (MyListHook* node = firstIt.node; node != lastIt.node; node = node->next)
+			{
+				node->owner = this;
+				count++;
+			}
+			MyListHook* before = firstIt.node->prev;
+			MyListHook* last = lastIt.node->prev;
+			before->next = lastIt.node;
+			lastIt.node->prev = before;
+			position.node->prev->next = firstIt.node;
+			firstIt.node->prev = position.node->prev;
+			position.node->prev = last;
+			last->next = position.node;
+			v_size += count;
+			list.v_size -= count;
+		}
+		void splice(iterator position, MyIntrusiveList&& list, iterator firstIt, iterator lastIt)
+		{
+			splice(position, list, firstIt, lastIt);
+		}
+
+		void remove_if(std::function<bool(const T&)> Comp)
+		{
+			MyListHook* current = head.next;
+			while (current != &tail)
+			{
+				MyListHook* next = current->next;
+				if (Comp(*_object(current)))
+					_unlink(current);
+				current = next;
+			}
+		}
+
+		void reverse() noexcept
+		{
+			if (head.next == &tail)
+				return;
+			MyListHook* first = head.next;
+			MyListHook* last = tail.prev;
+			MyListHook* node = first;
+			while (node != &tail)
+			{
+				MyListHook* temp = node->next;
+				node->next = node->prev;
+				node->prev = temp;
+				node = temp;
+			}
+			head.next = last;
+			last->prev = &head;
+			tail.prev = first;
+			first->next = &tail;
+		}
+	private:
+		//the offset of the hook inside T. a member pointer alone does not give it portably,
+		//so it is measured once on the first object that gets linked, every hook _object sees was linked after that
+		static std::ptrdiff_t _hookOffset(const T* object = nullptr)
+		{
+			static const std::ptrdiff_t offset = reinterpret_cast<const char*>(&(object->*Hook)) - reinterpret_cast<const char*>(object);
+			return offset;
+		}
+		//get the object a hook belongs to, works like offsetof but with the member pointer
+		static T* _object(MyListHook* node)
+		{
+			return reinterpret_cast<T*>(reinterpret_cast<char*>(node) - _hookOffset());
+		}
+		//moves all nodes of the donor behind our sentinels, we must be empty
+		void _takeNodes(MyIntrusiveList& donor) noexcept
+		{
+			if (donor.head.next == &donor.tail)
+				return;
+			for (MyListHook* node = donor.head.next; node != &donor.tail; node = node->next)
+				node->owner = this;
+			head.next = donor.head.next;
+			head.next->prev = &head;
+			tail.prev = donor.tail.prev;
+			tail.prev->next = &tail;
+			v_size = donor.v_size;
+			donor.head.next = &donor.tail;
+			donor.tail.prev = &donor.head;
+			donor.v_size = 0;
+		}
+		void _link(MyListHook* position, MyListHook* node) noexcept
+		{
+			node->owner = this;
+			node->prev = position->prev;
+			node->next = position;
+			position->prev->next = node;
+			position->prev = node;
+		}
+		void _unlink(MyListHook* node) noexcept
+		{
+			node->prev->next = node->next;
+			node->next->prev = node->prev;
+			node->prev = nullptr;
+			node->next = nullptr;
+			node->owner = nullptr;
+			v_size--;
+		}
+		void _validateIterator(const iterator& it)
+		{
+			if (it.list != this)
+				throw bad_iterator("Tried to pass iterator of other list");
+		}
+		void _validateIterator(const iterator& it, MyIntrusiveList* list)
+		{
+			if (it.list != list)
+				throw bad_iterator("Tried to pass iterator from wrong list");
+		}
+	};
+}
\ No newline at end of file
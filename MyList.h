@@ -3,6 +3,8 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <functional>
+#include <iterator>
+#include "MyNodePool.h"
 
 namespace MySTL
 {
@@ -47,18 +49,24 @@ namespace MySTL
 			{}
 		};
 	private:
-		struct Node
+		//the sentinels only need the links, so they carry no payload and live inside the list
+		struct NodeBase
+		{
+			NodeBase* prev;
+			NodeBase* next;
+		};
+		struct Node : public NodeBase
 		{
-			Node* prev;
-			Node* next;
 			T data;
-			Node(Node* prev, Node* next, T data = T())
+			//the payload is constructed in place from whatever the caller passed
+			template<typename... args>
+			Node(NodeBase* prev, NodeBase* next, args&&... vals)
 				:
-				prev(prev),
-				next(next),
-				data(data)
+				NodeBase{ prev, next },
+				data(std::forward<args>(vals)...)
 			{}
 		};
+		using NodePool = MyNodePool<sizeof(Node), alignof(Node)>;
 	public:
 		class iterator
 		{
@@ -85,9 +93,9 @@ namespace MySTL
 			friend class MyList;
 
 			MyList<T>* list;
-			Node* node;
+			NodeBase* node;
 		protected:
-			iterator(MyList<T>* list, Node* node)
+			iterator(MyList<T>* list, NodeBase* node)
 				:
 				list(list),
 				node(node)
@@ -95,20 +103,20 @@ namespace MySTL
 		public:
 			reference operator*() const
 			{
-				if (node == list->head || node == list->tail)
+				if (node == &list->head || node == &list->tail)
 					throw out_of_bounds("Tried to dereference invalid element");
-				return node->data;
+				return _value(node);
 			}
 			pointer operator->() const
 			{
-				if (node == list->head)
+				if (node == &list->head || node == &list->tail)
 					throw out_of_bounds("Tried to access invalid element");
-				return &node->data;
+				return &_value(node);
 			}
 
 			iterator& operator++()
 			{
-				if (node == list->tail)
+				if (node == &list->tail)
 					throw out_of_bounds("Tried to increment iterator out of bounds");
 				node = node->next;
 				return *this;
@@ -116,14 +124,14 @@ namespace MySTL
 			iterator operator++(int)
 			{
 				iterator result(*this);
-				if (node == list->tail)
+				if (node == &list->tail)
 					throw out_of_bounds("Tried to increment iterator out of bounds");
 				node = node->next;
 				return result;
 			}
 			iterator& operator--()
 			{
-				if (node->prev == list->head)
+				if (node->prev == &list->head)
 					throw out_of_bounds("Tried to decrement iterator out of bounds");
 				node = node->prev;
 				return *this;
@@ -131,7 +139,7 @@ namespace MySTL
 			iterator operator--(int)
 			{
 				iterator result(*this);
-				if (node->prev == list->head)
+				if (node->prev == &list->head)
 					throw out_of_bounds("Tried to decrement iterator out of bounds");
 				node = node->prev;
 				return result;
@@ -157,7 +165,7 @@ namespace MySTL
 		private:
 			friend class MyList;
 		protected:
-			const_iterator(const MyList<T>* list, Node* node)
+			const_iterator(const MyList<T>* list, NodeBase* node)
 				:
 				iterator(const_cast<MyList<T>*>(list), node)
 			{}
@@ -176,14 +184,14 @@ namespace MySTL
 		private:
 			friend class MyList;
 		protected:
-			reverse_iterator(MyList<T>* list, Node* node)
+			reverse_iterator(MyList<T>* list, NodeBase* node)
 				:
 				iterator(list, node)
 			{}
 		public:
 			reverse_iterator& operator++()
 			{
-				if (iterator::node == iterator::list->head)
+				if (iterator::node == &iterator::list->head)
 					throw out_of_bounds("Tried to increment reverse iterator past the reverse end");
 				iterator::node = iterator::node->prev;
 				return *this;
@@ -191,14 +199,14 @@ namespace MySTL
 			reverse_iterator operator++(int)
 			{
 				reverse_iterator result(*this);
-				if (iterator::node == iterator::list->head)
+				if (iterator::node == &iterator::list->head)
 					throw out_of_bounds("Tried to increment reverse iterator past the reverse end");
 				iterator::node = iterator::node->prev;
 				return result;
 			}
 			reverse_iterator& operator--()
 			{
-				if (iterator::node->next == iterator::list->tail)
+				if (iterator::node->next == &iterator::list->tail)
 					throw out_of_bounds("Tried to decrement reverse iterator past the reverse begin");
 				iterator::node = iterator::node->next;
 				return *this;
@@ -206,7 +214,7 @@ namespace MySTL
 			reverse_iterator operator--(int)
 			{
 				reverse_iterator result(*this);
-				if (iterator::node->next == iterator::list->tail)
+				if (iterator::node->next == &iterator::list->tail)
 					throw out_of_bounds("Tried to decrement reverse iterator past the reverse begin");
 				iterator::node = iterator::node->next;
 				return result;
@@ -217,7 +225,7 @@ namespace MySTL
 		private:
 			friend class MyList;
 		protected:
-			const_reverse_iterator(const MyList<T>* list, Node* node)
+			const_reverse_iterator(const MyList<T>* list, NodeBase* node)
 				:
 				reverse_iterator(const_cast<MyList<T>*>(list), node)
 			{}
@@ -234,118 +242,59 @@ namespace MySTL
 	private:
 		friend class iterator;
 
-		Node* head; //one element before the first
-		Node* tail; //one element after the last
+		NodeBase head; //one element before the first
+		NodeBase tail; //one element after the last
 		size_t v_size;
 	public:
-		MyList()
+		MyList() noexcept
 			:
-			head(new Node(nullptr, nullptr)),
-			tail(new Node(nullptr, nullptr)),
+			head{ nullptr, &tail },
+			tail{ &head, nullptr },
 			v_size(0)
-		{
-			head->next = tail;
-			tail->prev = head;
-		}
-		MyList(const MyList<T>& copy) noexcept
+		{}
+		MyList(const MyList<T>& copy)
 			:
-			head(new Node(nullptr, nullptr)),
-			tail(new Node(nullptr, nullptr)),
-			v_size(copy.v_size)
+			MyList()
 		{
-			head->next = tail;
-			tail->prev = head;
-			Node* current = head;
-			for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
+			_appendCopy(copy);
 		}
 		MyList(MyList<T>&& donor) noexcept
 			:
-			head(donor.head),
-			tail(donor.tail),
-			v_size(donor.v_size)
+			MyList()
 		{
-			donor.head = new Node(nullptr, nullptr);
-			donor.tail = new Node(head, nullptr);
-			donor.head->next = donor.tail;
+			_takeNodes(donor);
 		}
 		~MyList()
 		{
-			_safeDeleteAllChildren(head);
+			clear();
 		}
 
 		template<class Iter>
 		MyList(Iter firstIt, Iter lastIt)
 			:
-			head(new Node(nullptr, nullptr)),
-			tail(new Node(nullptr, nullptr)),
-			v_size(lastIt - firstIt)
+			MyList()
 		{
-			head->next = tail;
-			tail->prev = head;
-			Node* current = head;
-			for (auto it = firstIt; it != lastIt; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
+			_appendRange(firstIt, lastIt);
 		}
 		MyList(size_t size, const T& val = T())
 			:
-			head(new Node(nullptr, nullptr)),
-			tail(new Node(nullptr, nullptr)),
-			v_size(size)
+			MyList()
 		{
-			head->next = tail;
-			tail->prev = head;
-			Node* current = head;
-			for (size_t i = 0; i < size; ++i)
-			{
-				Node* node = new Node(current, tail, val);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
+			_appendFill(size, val);
 		}
 		MyList(std::initializer_list<T> list)
 			:
-			head(new Node(nullptr, nullptr)),
-			tail(new Node(nullptr, nullptr)),
-			v_size(list.size())
+			MyList()
 		{
-			head->next = tail;
-			tail->prev = head;
-			Node* current = head;
-			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
+			_appendRange(list.begin(), list.end());
 		}
 
-		MyList<T>& operator=(const MyList<T>& copy) noexcept
+		MyList<T>& operator=(const MyList<T>& copy)
 		{
 			if (this != &copy)
 			{
 				clear();
-				v_size = copy.v_size;
-				Node* current = head;
-				for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
-				{
-					Node* node = new Node(current, tail, *it);
-					current->next = node;
-					tail->prev = node;
-					current = node;
-				}
+				_appendCopy(copy);
 			}
 
 			return *this;
@@ -355,85 +304,40 @@ namespace MySTL
 			if (this != &donor)
 			{
 				clear();
-				v_size = donor.v_size;
-				head = donor.head;
-				tail = donor.tail;
-				donor.head = new Node(nullptr, nullptr);
-				donor.tail = new Node(head, nullptr);
-				donor.head->next = donor.tail;
+				_takeNodes(donor);
 			}
 
 			return *this;
 		}
 
-		MyList<T>& operator=(std::initializer_list<T> list) noexcept
+		MyList<T>& operator=(std::initializer_list<T> list)
 		{
-			clear();
-			Node* current = head;
-			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
-			v_size = list.size();
+			assign(list);
 			return *this;
 		}
 
 		void assign(size_t size, const T& val)
 		{
 			clear();
-			Node* current = head;
-			for (size_t i = 0; i < size; ++i)
-			{
-				Node* node = new Node(current, tail, val);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
-			v_size = size;
+			_appendFill(size, val);
 		}
 		template<class Iter>
 		void assign(Iter firstIt, Iter lastIt)
 		{
 			clear();
-			Node* current = head;
-			size_t count = 0;
-			for (auto it = firstIt; it != lastIt; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-				count++;
-			}
-			v_size = count;
+			_appendRange(firstIt, lastIt);
 		}
 		void assign(std::initializer_list<T> list)
 		{
 			clear();
-			Node* current = head;
-			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
-			{
-				Node* node = new Node(current, tail, *it);
-				current->next = node;
-				tail->prev = node;
-				current = node;
-			}
-			v_size = list.size();
+			_appendRange(list.begin(), list.end());
 		}
 
-		void swap(MyList<T>& list)
+		void swap(MyList<T>& list) noexcept
 		{
-			Node* tempHead = head;
-			Node* tempTail = tail;
-
-			head = list.head;
-			tail = list.tail;
-
-			list.head = tempHead;
-			list.tail = tempTail;
+			MyList<T> temp(std::move(list));
+			list._takeNodes(*this);
+			_takeNodes(temp);
 		}
 
 		size_t size() const
@@ -458,110 +362,89 @@ namespace MySTL
 				iterator it = begin();
 				for (size_t i = 0; i < size; i++, ++it)
 				{}
-				Node* toDelete = it.node;
-				it.node->prev->next = tail;
-				tail->prev->next = nullptr;
-				tail->prev = it.node->prev;
-				_safeDeleteAllChildren(toDelete);
-				v_size = size;
+				NodeBase* last = it.node->prev;
+				_destroyRange(it.node, &tail);
+				last->next = &tail;
+				tail.prev = last;
 			}
 			else if (v_size < size)
 			{
-				for (size_t i = v_size; i < size; i++)
-				{
-					Node* node = new Node(tail->prev, tail, val);
-					tail->prev->next = node;
-					tail->prev = node;
-				}
-				v_size = size;
+				_appendFill(size - v_size, val);
 			}
 		}
 
 		void clear()
 		{
-			tail->prev->next = nullptr;
-			_safeDeleteAllChildren(head->next);
-			head->next = tail;
-			v_size = 0;
+			_destroyRange(head.next, &tail);
+			head.next = &tail;
+			tail.prev = &head;
 		}
 
 		T& front()
 		{
 			if (empty())
 				throw exception("Cannot access element in empty list");
-			return head->next->data;
+			return _value(head.next);
 		}
 		const T& front() const
 		{
 			if (empty())
 				throw exception("Cannot access element in empty list");
-			return head->next->data;
+			return _value(head.next);
 		}
 		T& back()
 		{
 			if (empty())
 				throw exception("Cannot access element in empty list");
-			return tail->prev->data;
+			return _value(tail.prev);
 		}
 		const T& back() const
 		{
 			if (empty())
 				throw exception("Cannot access element in empty list");
-			return tail->prev->data;
+			return _value(tail.prev);
 		}
 
 		iterator begin()
 		{
-			return iterator(this, head->next);
+			return iterator(this, head.next);
 		}
 		const_iterator cbegin() const
 		{
-			return const_iterator(this, head->next);
+			return const_iterator(this, head.next);
 		}
 		reverse_iterator rbegin()
 		{
-			return reverse_iterator(this, tail->prev);
+			return reverse_iterator(this, tail.prev);
 		}
 		const_reverse_iterator crbegin() const
 		{
-			return const_reverse_iterator(this, tail->prev);
+			return const_reverse_iterator(this, tail.prev);
 		}
 		iterator end()
 		{
-			return iterator(this, tail);
+			return iterator(this, &tail);
 		}
 		const_iterator cend() const
 		{
-			return const_iterator(this, tail);
+			return const_iterator(this, const_cast<NodeBase*>(&tail));
 		}
 		reverse_iterator rend()
 		{
-			return reverse_iterator(this, head);
+			return reverse_iterator(this, &head);
 		}
 		const_reverse_iterator crend() const
 		{
-			return const_reverse_iterator(this, head);
+			return const_reverse_iterator(this, const_cast<NodeBase*>(&head));
 		}
 
 		iterator insert(iterator position, const T& val)
 		{
-			_validateIterator(position);
-			Node* old = position.node;
-			Node* node = new Node(old->prev, old, val);
-			old->prev->next = node;
-			old->prev = node;
-			v_size++;
-			return iterator(this, node);
+			return emplace(position, val);
 		}
 		iterator insert(iterator position, T&& val)
 		{
-			_validateIterator(position);
-			Node* old = position.node;
-			Node* node = new Node(old->prev, old, std::move(val));
-			old->prev->next = node;
-			old->prev = node;
-			v_size++;
-			return iterator(this, node);
+			return emplace(position, std::move(val));
 		}
 		iterator insert(iterator position, size_t count, const T& val)
 		{
@@ -570,7 +453,6 @@ namespace MySTL
 			{
 				position = insert(position, val);
 			}
-			v_size += count;
 			return position;
 		}
 		iterator insert(iterator position, std::initializer_list<T> list)
@@ -581,38 +463,40 @@ namespace MySTL
 			{
 				insert(position, *it);
 			}
-			v_size += list.size();
 			return ret;
 		}
 		template<class Iter>
 		iterator insert(iterator position, Iter firstIt, Iter lastIt)
 		{
 			_validateIterator(position);
-			size_t count = 0;
-			iterator ret = insert(position, *firstIt);;
+			iterator ret = insert(position, *firstIt);
 			for (auto it = ++firstIt; it != lastIt; ++it)
 			{
 				insert(position, *it);
-				count++;
 			}
-			v_size += count;
 			return ret;
 		}
 
 		template<typename... args>
 		iterator emplace(iterator position, args&&... vals)
 		{
-			return insert(position, T(std::move(vals...)));
+			_validateIterator(position);
+			NodeBase* old = position.node;
+			NodeBase* node = _createNode(old->prev, old, std::forward<args>(vals)...);
+			old->prev->next = node;
+			old->prev = node;
+			v_size++;
+			return iterator(this, node);
 		}
 		template<typename... args>
 		void emplace_back(args&&... vals)
 		{
-			insert(end(), std::move(vals...));
+			emplace(end(), std::forward<args>(vals)...);
 		}
 		template<typename... args>
 		void emplace_front(args&&... vals)
 		{
-			insert(begin(), std::move(vals...));
+			emplace(begin(), std::forward<args>(vals)...);
 		}
 
 		void push_back(const T& val)
@@ -634,16 +518,16 @@ namespace MySTL
 
 		void pop_back()
 		{
-			_safeDelete(tail->prev);
+			_safeDelete(tail.prev);
 		}
 		void pop_front()
 		{
-			_safeDelete(head->next);
+			_safeDelete(head.next);
 		}
 
 		void erase(iterator position)
 		{
-			if (position.node == head || position.node == tail)
+			if (position.node == &head || position.node == &tail)
 				throw out_of_bounds("Tried to delete element out of bounds");
 			_validateIterator(position);
 			_safeDelete(position.node);
@@ -652,10 +536,14 @@ namespace MySTL
 		{
 			_validateIterator(firstIt);
 			_validateIterator(lastIt);
-			firstIt.node->prev->next = lastIt.node;
-			lastIt.node->prev->next = nullptr;
-			lastIt.node->prev = firstIt.node->prev;
-			_safeDeleteAllChildren(firstIt.node);
+			if (firstIt.node == &head)
+				throw out_of_bounds("Tried to delete element out of bounds");
+			if (firstIt == lastIt)
+				return lastIt;
+			NodeBase* before = firstIt.node->prev;
+			_destroyRange(firstIt.node, lastIt.node);
+			before->next = lastIt.node;
+			lastIt.node->prev = before;
 			return lastIt;
 		}
 
@@ -664,12 +552,12 @@ namespace MySTL
 			if (list.empty() || &list == this)
 				return;
 			_validateIterator(position);
-			list.tail->prev->next = position.node;
-			list.head->next->prev = position.node->prev;
-			position.node->prev->next = list.head->next;
-			position.node->prev = list.tail->prev;
-			list.head->next = list.tail;
-			list.tail->prev = list.head;
+			list.tail.prev->next = position.node;
+			list.head.next->prev = position.node->prev;
+			position.node->prev->next = list.head.next;
+			position.node->prev = list.tail.prev;
+			list.head.next = &list.tail;
+			list.tail.prev = &list.head;
 			v_size += list.v_size;
 			list.v_size = 0;
 		}
@@ -689,6 +577,8 @@ namespace MySTL
 			from.node->prev = position.node->prev;
 			position.node->prev = from.node;
 			from.node->next = position.node;
+			v_size++;
+			list.v_size--;
 		}
 		void splice(iterator position, MyList<T>&& list, iterator from)
 		{
@@ -701,12 +591,21 @@ namespace MySTL
 			_validateIterator(position);
 			_validateIterator(firstIt, &list);
 			_validateIterator(lastIt, &list);
+			if (firstIt == lastIt)
+				return;
+			size_t count = 0;
+			for (NodeBase* node = firstIt.node; node != lastIt.node; node = node->next)
+				count++;
+			NodeBase* before = firstIt.node->prev;
+			NodeBase* last = lastIt.node->prev;
+			before->next = lastIt.node;
+			lastIt.node->prev = before;
 			position.node->prev->next = firstIt.node;
-			firstIt.node->prev->next = lastIt.node;
 			firstIt.node->prev = position.node->prev;
-			position.node->prev = lastIt.node->prev;
-			lastIt.node->prev->next = position.node;
-			lastIt.node->prev = firstIt.node->prev;
+			position.node->prev = last;
+			last->next = position.node;
+			v_size += count;
+			list.v_size -= count;
 		}
 		void splice(iterator position, MyList<T>&& list, iterator firstIt, iterator lastIt)
 		{
@@ -715,12 +614,12 @@ namespace MySTL
 
 		void remove(const T& val)
 		{
-			Node* current = head->next;
-			while( current != tail)
+			NodeBase* current = head.next;
+			while( current != &tail)
 			{
-				if (current->data == val)
+				if (_value(current) == val)
 				{
-					Node* del = current;
+					NodeBase* del = current;
 					current = current->next;
 					_safeDelete(del);
 				}
@@ -730,12 +629,12 @@ namespace MySTL
 		}
 		void remove_if(std::function<bool(T val)> Comp)
 		{
-			Node* current = head->next;
-			while ( current != tail)
+			NodeBase* current = head.next;
+			while ( current != &tail)
 			{
-				if (Comp(current->data))
+				if (Comp(_value(current)))
 				{
-					Node* del = current;
+					NodeBase* del = current;
 					current = current->next;
 					_safeDelete(del);
 				}
@@ -746,10 +645,11 @@ namespace MySTL
 
 		void unique()
 		{
-			Node* current = head->next;
-			while (current != tail)
+			NodeBase* current = head.next;
+			//the tail sentinel has no value to compare against
+			while (current != &tail && current->next != &tail)
 			{
-				if (current->next->data == current->data)
+				if (_value(current->next) == _value(current))
 				{
 					_safeDelete(current->next);
 				}
@@ -761,10 +661,10 @@ namespace MySTL
 		}
 		void unique(std::function<bool(T val)> Comp)
 		{
-			Node* current = head->next;
-			while (current != tail)
+			NodeBase* current = head.next;
+			while (current != &tail && current->next != &tail)
 			{
-				if (Comp(current->next->data, current->data))
+				if (Comp(_value(current->next), _value(current)))
 				{
 					_safeDelete(current->next);
 				}
@@ -779,15 +679,15 @@ namespace MySTL
 		{
 			if (empty())
 				return;
-			for (Node* current = head; current->next != tail; current = current->next)
+			for (NodeBase* current = head.next; current->next != &tail; current = current->next)
 			{
-				for (Node* index = current->next; index != tail; index = index->next)
+				for (NodeBase* index = current->next; index != &tail; index = index->next)
 				{
-					if (current->data > index->data)
+					if (_value(current) > _value(index))
 					{
-						T temp = current->data;
-						current->data = index->data;
-						index->data = temp;
+						T temp = _value(current);
+						_value(current) = _value(index);
+						_value(index) = temp;
 					}
 				}
 			}
@@ -796,15 +696,15 @@ namespace MySTL
 		{
 			if (empty())
 				return;
-			for (Node* current = head; current->next != tail; current = current->next)
+			for (NodeBase* current = head.next; current->next != &tail; current = current->next)
 			{
-				for (Node* index = current->next; index != tail; index = index->next)
+				for (NodeBase* index = current->next; index != &tail; index = index->next)
 				{
-					if (!Comp(current->data > index->data))
+					if (!Comp(_value(current), _value(index)))
 					{
-						T temp = current->data;
-						current->data = index->data;
-						index->data = temp;
+						T temp = _value(current);
+						_value(current) = _value(index);
+						_value(index) = temp;
 					}
 				}
 			}
@@ -812,69 +712,7 @@ namespace MySTL
 
 		void merge(MyList<T>& list)
 		{
-			if (list.empty() || &list == this)
-				return;
-			if (empty() && !list.empty())
-			{
-				swap(list);
-				return;
-			}
-			sort();
-			list.sort();
-
-			Node* newHead = nullptr;
-			Node* head1 = head->next;
-			Node* head2 = list.head->next;
-
-			if (head1->data <= head2->data)
-			{
-				newHead = head1;
-				head1 = head1->next;
-			}
-			else
-			{
-				newHead = head2;
-				head2 = head2->next;
-			}
-
-			Node* newTail = newHead;
-
-			while (head1 != tail && head2 != list.tail)
-			{
-				if (head1->data <= head2->data)
-				{
-					head1 = _safeAttachNode(newTail, head1);
-				}
-				else
-				{
-					head2 = _safeAttachNode(newTail, head2);
-				}
-				newTail = newTail->next;
-			}
-
-			if (head1 != tail)
-			{
-				while (head1 != tail)
-				{
-					head1 = _safeAttachNode(newTail, head1);
-					newTail = newTail->next;
-				}
-			}
-			else if (head2 != list.tail)
-			{
-				while (head2 != list.tail)
-				{
-					head2 = _safeAttachNode(newTail, head2);
-					newTail = newTail->next;
-				}
-			}
-
-			head->next = newHead;
-			tail->prev = newTail;
-			list.head->next = list.tail;
-			list.tail->prev = list.head;
-			v_size += list.v_size;
-			list.v_size = 0;
+			merge(list, [](T x, T y) { return x <= y; });
 		}
 		void merge(MyList<T>&& list)
 		{
@@ -892,57 +730,17 @@ namespace MySTL
 			sort(Comp);
 			list.sort(Comp);
 
-			Node* newHead = nullptr;
-			Node* head1 = head->next;
-			Node* head2 = list.head->next;
-
-			if (Comp(head1->data, head2->data))
+			//move every node of list in front of the first of our nodes that it has to preceed
+			NodeBase* head1 = head.next;
+			NodeBase* head2 = list.head.next;
+			while (head2 != &list.tail)
 			{
-				newHead = head1;
-				head1 = head1->next;
-			}
-			else
-			{
-				newHead = head2;
-				head2 = head2->next;
-			}
-
-			Node* newTail = newHead;
-
-			while (head1 != tail && head2 != list.tail)
-			{
-				if (Comp(head1->data, head2->data))
-				{
-					head1 = _safeAttachNode(newTail, head1);
-				}
+				if (head1 == &tail || !Comp(_value(head1), _value(head2)))
+					head2 = _safeAttachNode(head1->prev, head2);
 				else
-				{
-					head2 = _safeAttachNode(newTail, head2);
-				}
-				newTail = newTail->next;
-			}
-
-			if (head1 != tail)
-			{
-				while (head1 != tail)
-				{
-					head1 = _safeAttachNode(newTail, head1);
-					newTail = newTail->next;
-				}
-			}
-			else if (head2 != list.tail)
-			{
-				while (head2 != list.tail)
-				{
-					head2 = _safeAttachNode(newTail, head2);
-					newTail = newTail->next;
-				}
+					head1 = head1->next;
 			}
 
-			head->next = newHead;
-			tail->prev = newTail;
-			list.head->next = list.tail;
-			list.tail->prev = list.head;
 			v_size += list.v_size;
 			list.v_size = 0;
 		}
@@ -951,46 +749,164 @@ namespace MySTL
 			merge(list, Comp);
 		}
 
-		void reverse()
+		void reverse() noexcept
 		{
-			Node* node = head;
-			while (node != nullptr)
+			if (head.next == &tail)
+				return;
+			NodeBase* first = head.next;
+			NodeBase* last = tail.prev;
+			NodeBase* node = first;
+			while (node != &tail)
 			{
-				Node* temp = node->next;
+				NodeBase* temp = node->next;
 				node->next = node->prev;
 				node->prev = temp;
-				if (temp == nullptr)
-				{
-					tail = head;
-					head = node;
-				}
 				node = temp;
 			}
+			//the old first and last still point at the sentinels they came from
+			head.next = last;
+			last->prev = &head;
+			tail.prev = first;
+			first->next = &tail;
 		}
 	private:
-		void _safeDelete(Node* node)
+		static T& _value(NodeBase* node)
+		{
+			return static_cast<Node*>(node)->data;
+		}
+		template<typename... args>
+		NodeBase* _createNode(NodeBase* prev, NodeBase* next, args&&... vals)
+		{
+			void* memory = NodePool::allocate();
+			try
+			{
+				return new (memory) Node(prev, next, std::forward<args>(vals)...);
+			}
+			catch (...)
+			{
+				NodePool::deallocate(memory);
+				throw;
+			}
+		}
+		void _destroyNode(NodeBase* node) noexcept
+		{
+			static_cast<Node*>(node)->~Node();
+			NodePool::deallocate(node);
+		}
+		//builds the chain behind the last node with every new node already pointing at the tail,
+		//so the tail sentinel and the size are only patched once. makeNode returns nullptr when it is done
+		template<class MakeNode>
+		void _appendNodes(MakeNode makeNode)
+		{
+			NodeBase* last = tail.prev;
+			NodeBase* current = last;
+			size_t count = 0;
+			try
+			{
+				for (NodeBase* node = makeNode(current); node != nullptr; node = makeNode(current), count++)
+				{
+					current->next = node;
+					current = node;
+				}
+			}
+			catch (...)
+			{
+				NodeBase* node = last->next;
+				while (node != &tail)
+				{
+					NodeBase* next = node->next;
+					_destroyNode(node);
+					node = next;
+				}
+				last->next = &tail;
+				throw;
+			}
+			tail.prev = current;
+			v_size += count;
+		}
+		template<class Iter>
+		void _appendRange(Iter firstIt, Iter lastIt)
+		{
+			_reserveFor(firstIt, lastIt, typename std::iterator_traits<Iter>::iterator_category());
+			_appendNodes([&](NodeBase* prev) -> NodeBase* {
+				if (firstIt == lastIt)
+					return nullptr;
+				NodeBase* node = _createNode(prev, &tail, *firstIt);
+				++firstIt;
+				return node;
+			});
+		}
+		//a range whose length is known gets all its nodes from one chunk
+		template<class Iter>
+		static void _reserveFor(Iter firstIt, Iter lastIt, std::forward_iterator_tag)
+		{
+			NodePool::reserve(static_cast<size_t>(std::distance(firstIt, lastIt)));
+		}
+		template<class Iter>
+		static void _reserveFor(Iter, Iter, std::input_iterator_tag)
+		{}
+		void _appendFill(size_t count, const T& val)
+		{
+			NodePool::reserve(count);
+			_appendNodes([&](NodeBase* prev) -> NodeBase* {
+				if (count == 0)
+					return nullptr;
+				count--;
+				return _createNode(prev, &tail, val);
+			});
+		}
+		//walks the nodes of copy directly instead of going through its checked iterators
+		void _appendCopy(const MyList<T>& copy)
+		{
+			NodePool::reserve(copy.v_size);
+			const NodeBase* source = copy.head.next;
+			_appendNodes([&](NodeBase* prev) -> NodeBase* {
+				if (source == &copy.tail)
+					return nullptr;
+				NodeBase* node = _createNode(prev, &tail, static_cast<const Node*>(source)->data);
+				source = source->next;
+				return node;
+			});
+		}
+		//moves all nodes of the donor behind our sentinels, we must be empty
+		void _takeNodes(MyList<T>& donor) noexcept
+		{
+			if (donor.head.next == &donor.tail)
+				return;
+			head.next = donor.head.next;
+			head.next->prev = &head;
+			tail.prev = donor.tail.prev;
+			tail.prev->next = &tail;
+			v_size = donor.v_size;
+			donor.head.next = &donor.tail;
+			donor.tail.prev = &donor.head;
+			donor.v_size = 0;
+		}
+		void _safeDelete(NodeBase* node)
 		{
 			node->prev->next = node->next;
 			node->next->prev = node->prev;
-			delete node;
+			_destroyNode(node);
 			v_size--;
 		}
-		void _safeDeleteAllChildren(Node* node) //until now leaves the parents next and the childs prev dangling
+		//destroys the nodes from first up to stop in one pass and gives them back to the pool as one chain,
+		//the links around the range are left for the caller to patch
+		void _destroyRange(NodeBase* first, NodeBase* stop) noexcept
 		{
-			size_t count = 0;
-			while (node->next != nullptr)
+			typename NodePool::FreeChain chain;
+			while (first != stop)
 			{
-				Node* temp = node->next;
-				node->next = temp->next;
-				delete temp;
-				count++;
+				NodeBase* next = first->next;
+				static_cast<Node*>(first)->~Node();
+				chain.push(first);
+				first = next;
 			}
-			delete node;
-			v_size -= ++count;
+			v_size -= chain.size();
+			NodePool::deallocate(chain);
 		}
-		Node* _safeAttachNode(Node* newParent, Node* node) //return the next of the old node
+		NodeBase* _safeAttachNode(NodeBase* newParent, NodeBase* node) //return the next of the old node
 		{
-			Node* ret = node->next;
+			NodeBase* ret = node->next;
 			node->prev->next = node->next;
 			node->next->prev = node->prev;
 			node->prev = newParent;
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+
+namespace MySTL
+{
+	//hands out memory for list nodes of one size, carved from chunks that grow geometrically.
+	//freed nodes go to a free list of the freeing thread and are handed out again before a new chunk is allocated,
+	//once a thread keeps more than twice keepFree nodes the surplus goes to a shared list that any thread empties
+	//before it allocates a chunk, so nodes freed by a consumer thread get back to the producer.
+	//chunks are kept for the lifetime of the program, so nodes stay valid no matter which thread or list frees them
+	template<size_t NodeSize, size_t NodeAlign>
+	class MyNodePool
+	{
+	private:
+		struct FreeNode
+		{
+			FreeNode* next;
+		};
+		//header in front of every chunk, all chunks stay reachable through chunks()
+		struct Chunk
+		{
+			Chunk* next;
+		};
+		//the free list of one thread, trivially destructible so it can still be used while other thread_locals are destroyed
+		struct Cache
+		{
+			FreeNode* first;
+			FreeNode* last;
+			size_t count;
+			size_t chunkSize;
+			bool exiting; //set once the thread exits, every node freed after that goes straight to the shared list
+		};
+		//gives the free nodes of an exiting thread to the other threads
+		struct CacheFlush
+		{
+			~CacheFlush()
+			{
+				Cache& cache = _cache();
+				cache.exiting = true;
+				_release(cache, 0);
+			}
+		};
+
+		static constexpr size_t slotAlign = NodeAlign > alignof(FreeNode) ? NodeAlign : alignof(FreeNode);
+		static constexpr size_t slotSize = ((NodeSize > sizeof(FreeNode) ? NodeSize : sizeof(FreeNode)) + slotAlign - 1) / slotAlign * slotAlign;
+		static constexpr size_t headerSize = (sizeof(Chunk) + slotAlign - 1) / slotAlign * slotAlign;
+		static constexpr size_t firstChunkSize = 64;
+		static constexpr size_t maxChunkSize = 65536;
+		static constexpr size_t keepFree = 512;
+	public:
+		//collects freed nodes so a whole range of them is handed back to the free list at once
+		class FreeChain
+		{
+		private:
+			friend class MyNodePool;
+
+			FreeNode* first = nullptr;
+			FreeNode* last = nullptr;
+			size_t count = 0;
+		public:
+			//node must not be read after this, its first bytes are reused for the link
+			void push(void* node) noexcept
+			{
+				FreeNode* freeNode = static_cast<FreeNode*>(node);
+				freeNode->next = first;
+				first = freeNode;
+				if (last == nullptr)
+					last = freeNode;
+				count++;
+			}
+			size_t size() const noexcept
+			{
+				return count;
+			}
+		};
+
+		static void* allocate()
+		{
+			Cache& cache = _cache();
+			if (cache.first == nullptr)
+			{
+				_acquireShared(cache);
+				if (cache.first == nullptr)
+					_allocateChunk(cache, _nextChunkSize(cache));
+			}
+			FreeNode* node = cache.first;
+			cache.first = node->next;
+			if (cache.first == nullptr)
+				cache.last = nullptr;
+			cache.count--;
+			return node;
+		}
+		static void deallocate(void* node) noexcept
+		{
+			Cache& cache = _cache();
+			FreeNode* freeNode = static_cast<FreeNode*>(node);
+			freeNode->next = cache.first;
+			if (cache.first == nullptr)
+				cache.last = freeNode;
+			cache.first = freeNode;
+			cache.count++;
+			_trim(cache);
+		}
+		static void deallocate(FreeChain& chain) noexcept
+		{
+			if (chain.first == nullptr)
+				return;
+			Cache& cache = _cache();
+			chain.last->next = cache.first;
+			if (cache.first == nullptr)
+				cache.last = chain.last;
+			cache.first = chain.first;
+			cache.count += chain.count;
+			chain.first = chain.last = nullptr;
+			chain.count = 0;
+			_trim(cache);
+		}
+		//make sure the next count allocations of this thread are served without another chunk allocation
+		static void reserve(size_t count)
+		{
+			Cache& cache = _cache();
+			if (cache.count < count)
+				_acquireShared(cache);
+			if (cache.count < count)
+				_allocateChunk(cache, count - cache.count);
+		}
+	private:
+		static Cache& _cache()
+		{
+			thread_local Cache cache = { nullptr, nullptr, 0, firstChunkSize, false };
+			thread_local CacheFlush flush;
+			(void)flush;
+			return cache;
+		}
+		//free nodes handed over by other threads, linked through FreeNode::next like a thread's own list
+		static std::atomic<FreeNode*>& _shared()
+		{
+			static std::atomic<FreeNode*> shared(nullptr);
+			return shared;
+		}
+		static std::atomic<Chunk*>& _chunks()
+		{
+			static std::atomic<Chunk*> chunks(nullptr);
+			return chunks;
+		}
+		static void _trim(Cache& cache) noexcept
+		{
+			if (cache.exiting)
+				_release(cache, 0);
+			else if (cache.count > keepFree * 2)
+				_release(cache, keepFree);
+		}
+		//pushes all but the first keep nodes of the cache onto the shared list, the ones kept were freed last and are likely still cached
+		static void _release(Cache& cache, size_t keep) noexcept
+		{
+			if (cache.count <= keep)
+				return;
+			FreeNode* first;
+			FreeNode* last = cache.last;
+			if (keep == 0)
+			{
+				first = cache.first;
+				cache.first = cache.last = nullptr;
+			}
+			else
+			{
+				FreeNode* split = cache.first;
+				for (size_t i = 1; i < keep; i++)
+					split = split->next;
+				first = split->next;
+				split->next = nullptr;
+				cache.last = split;
+			}
+			cache.count = keep;
+
+			//only whole lists are pushed and taken, so nodes changing hands in between cannot cause ABA
+			std::atomic<FreeNode*>& shared = _shared();
+			FreeNode* top = shared.load(std::memory_order_relaxed);
+			do
+			{
+				last->next = top;
+			} while (!shared.compare_exchange_weak(top, first, std::memory_order_release, std::memory_order_relaxed));
+		}
+		//takes everything on the shared list, counting it costs one pass over nodes that are about to be handed out anyway
+		static void _acquireShared(Cache& cache)
+		{
+			std::atomic<FreeNode*>& shared = _shared();
+			if (shared.load(std::memory_order_relaxed) == nullptr)
+				return;
+			FreeNode* first = shared.exchange(nullptr, std::memory_order_acquire);
+			if (first == nullptr)
+				return;
+			FreeNode* last = first;
+			size_t count = 1;
+			for (; last->next != nullptr; last = last->next)
+				count++;
+			last->next = cache.first;
+			if (cache.first == nullptr)
+				cache.last = last;
+			cache.first = first;
+			cache.count += count;
+		}
+		//the chunk size of this thread doubles with every chunk up to maxChunkSize nodes
+		static size_t _nextChunkSize(Cache& cache)
+		{
+			size_t size = cache.chunkSize;
+			if (cache.chunkSize < maxChunkSize)
+				cache.chunkSize *= 2;
+			return size;
+		}
+		static void _allocateChunk(Cache& cache, size_t count)
+		{
+			char* memory = static_cast<char*>(::operator new(headerSize + slotSize * count + slotAlign));
+			Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+			chunk->next = _chunks().load(std::memory_order_relaxed);
+			while (!_chunks().compare_exchange_weak(chunk->next, chunk, std::memory_order_release, std::memory_order_relaxed))
+			{}
+
+			//::operator new only guarantees fundamental alignment, so align the first slot by hand
+			size_t offset = reinterpret_cast<size_t>(memory + headerSize) % slotAlign;
+			char* slots = memory + headerSize + (offset == 0 ? 0 : slotAlign - offset);
+			if (cache.first == nullptr)
+				cache.last = reinterpret_cast<FreeNode*>(slots + slotSize * (count - 1));
+			for (size_t i = count; i > 0; i--)
+			{
+				FreeNode* node = reinterpret_cast<FreeNode*>(slots + slotSize * (i - 1));
+				node->next = cache.first;
+				cache.first = node;
+			}
+			cache.count += count;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include "MyVector.h"
+#include "MySpan.h"
+#include "MyThreadPool.h"
+
+namespace MySTL
+{
+	//data parallel algorithms over MySpan and MyVector ranges, on the given pool or on MyThreadPool::shared().
+	//the functions are called concurrently from several threads, reductions need an associative and commutative op
+
+	namespace ParallelDetail
+	{
+		//below this many elements a chunk costs more to hand out than to run
+		constexpr size_t minGrain = 1024;
+
+		//one slot per participant, padded so neighbouring participants do not share a cache line
+		template<typename T>
+		struct alignas(64) Partial
+		{
+			T value;
+			bool used = false;
+		};
+	}
+
+	template<typename T, typename Func>
+	void par_for_each(MyThreadPool& pool, MySpan<T> range, Func func)
+	{
+		T* data = range.data();
+		pool.parallel_for(range.size(), ParallelDetail::minGrain, [&](size_t first, size_t last, size_t) {
+			for (size_t i = first; i < last; i++)
+				func(data[i]);
+		});
+	}
+	template<typename T, typename Func>
+	void par_for_each(MyThreadPool& pool, MyVector<T>& vec, Func func)
+	{
+		par_for_each(pool, MySpan<T>(vec), func);
+	}
+	template<typename T, typename Func>
+	void par_for_each(MySpan<T> range, Func func)
+	{
+		par_for_each(MyThreadPool::shared(), range, func);
+	}
+	template<typename T, typename Func>
+	void par_for_each(MyVector<T>& vec, Func func)
+	{
+		par_for_each(MyThreadPool::shared(), MySpan<T>(vec), func);
+	}
+
+	//out[i] = func(in[i]), out has to hold at least as many elements as in and may be in itself
+	template<typename T, typename U, typename Func>
+	void par_transform(MyThreadPool& pool, MySpan<T> in, MySpan<U> out, Func func)
+	{
+		if (out.size() < in.size())
+			throw typename MySpan<U>::out_of_bounds("Output range is smaller than the input range");
+		T* source = in.data();
+		U* target = out.data();
+		pool.parallel_for(in.size(), ParallelDetail::minGrain, [&](size_t first, size_t last, size_t) {
+			for (size_t i = first; i < last; i++)
+				target[i] = func(source[i]);
+		});
+	}
+	template<typename T, typename U, typename Func>
+	void par_transform(MyThreadPool& pool, const MyVector<T>& in, MyVector<U>& out, Func func)
+	{
+		par_transform(pool, MySpan<const T>(in), MySpan<U>(out), func);
+	}
+	template<typename T, typename U, typename Func>
+	void par_transform(MySpan<T> in, MySpan<U> out, Func func)
+	{
+		par_transform(MyThreadPool::shared(), in, out, func);
+	}
+	template<typename T, typename U, typename Func>
+	void par_transform(const MyVector<T>& in, MyVector<U>& out, Func func)
+	{
+		par_transform(MyThreadPool::shared(), MySpan<const T>(in), MySpan<U>(out), func);
+	}
+
+	//init combined with every element through op, in no particular order
+	template<typename T, typename V, typename Op>
+	V par_reduce(MyThreadPool& pool, MySpan<T> range, V init, Op op)
+	{
+		std::unique_ptr<ParallelDetail::Partial<V>[]> partials(new ParallelDetail::Partial<V>[pool.concurrency()]);
+		T* data = range.data();
+		pool.parallel_for(range.size(), ParallelDetail::minGrain, [&](size_t first, size_t last, size_t participant) {
+			V sum = data[first];
+			for (size_t i = first + 1; i < last; i++)
+				sum = op(sum, data[i]);
+			ParallelDetail::Partial<V>& partial = partials[participant];
+			partial.value = partial.used ? op(partial.value, sum) : sum;
+			partial.used = true;
+		});
+		for (size_t i = 0; i < pool.concurrency(); i++)
+		{
+			if (partials[i].used)
+				init = op(init, partials[i].value);
+		}
+		return init;
+	}
+	template<typename T, typename V, typename Op>
+	V par_reduce(MyThreadPool& pool, const MyVector<T>& vec, V init, Op op)
+	{
+		return par_reduce(pool, MySpan<const T>(vec), init, op);
+	}
+	template<typename T, typename V, typename Op>
+	V par_reduce(MySpan<T> range, V init, Op op)
+	{
+		return par_reduce(MyThreadPool::shared(), range, init, op);
+	}
+	template<typename T, typename V, typename Op>
+	V par_reduce(const MyVector<T>& vec, V init, Op op)
+	{
+		return par_reduce(MyThreadPool::shared(), MySpan<const T>(vec), init, op);
+	}
+
+	template<typename T, typename Pred>
+	size_t par_count_if(MyThreadPool& pool, MySpan<T> range, Pred pred)
+	{
+		std::unique_ptr<ParallelDetail::Partial<size_t>[]> counts(new ParallelDetail::Partial<size_t>[pool.concurrency()]);
+		for (size_t i = 0; i < pool.concurrency(); i++)
+			counts[i].value = 0;
+		T* data = range.data();
+		pool.parallel_for(range.size(), ParallelDetail::minGrain, [&](size_t first, size_t last, size_t participant) {
+			size_t count = 0;
+			for (size_t i = first; i < last; i++)
+			{
+				if (pred(data[i]))
+					count++;
+			}
+			counts[participant].value += count;
+		});
+		size_t count = 0;
+		for (size_t i = 0; i < pool.concurrency(); i++)
+			count += counts[i].value;
+		return count;
+	}
+	template<typename T, typename Pred>
+	size_t par_count_if(MyThreadPool& pool, const MyVector<T>& vec, Pred pred)
+	{
+		return par_count_if(pool, MySpan<const T>(vec), pred);
+	}
+	template<typename T, typename Pred>
+	size_t par_count_if(MySpan<T> range, Pred pred)
+	{
+		return par_count_if(MyThreadPool::shared(), range, pred);
+	}
+	template<typename T, typename Pred>
+	size_t par_count_if(const MyVector<T>& vec, Pred pred)
+	{
+		return par_count_if(MyThreadPool::shared(), MySpan<const T>(vec), pred);
+	}
+
+	//index of the first element that satisfies pred, or the size of the range if there is none.
+	//chunks behind the best match found so far are skipped
+	template<typename T, typename Pred>
+	size_t par_find_if(MyThreadPool& pool, MySpan<T> range, Pred pred)
+	{
+		std::atomic<size_t> best(range.size());
+		T* data = range.data();
+		pool.parallel_for(range.size(), ParallelDetail::minGrain, [&](size_t first, size_t last, size_t) {
+			for (size_t i = first; i < last && i < best.load(std::memory_order_relaxed); i++)
+			{
+				if (pred(data[i]))
+				{
+					size_t current = best.load(std::memory_order_relaxed);
+					while (i < current && !best.compare_exchange_weak(current, i, std::memory_order_relaxed))
+					{}
+					return;
+				}
+			}
+		});
+		return best.load(std::memory_order_relaxed);
+	}
+	template<typename T, typename Pred>
+	size_t par_find_if(MyThreadPool& pool, const MyVector<T>& vec, Pred pred)
+	{
+		return par_find_if(pool, MySpan<const T>(vec), pred);
+	}
+	template<typename T, typename Pred>
+	size_t par_find_if(MySpan<T> range, Pred pred)
+	{
+		return par_find_if(MyThreadPool::shared(), range, pred);
+	}
+	template<typename T, typename Pred>
+	size_t par_find_if(const MyVector<T>& vec, Pred pred)
+	{
+		return par_find_if(MyThreadPool::shared(), MySpan<const T>(vec), pred);
+	}
+
+	//out[i] = in[0] op ... op in[i], out has to hold at least as many elements as in and may be in itself.
+	//scans fixed blocks in parallel, carries the block totals over serially and adds them in a second parallel pass
+	template<typename T, typename U, typename Op>
+	void par_inclusive_scan(MyThreadPool& pool, MySpan<T> in, MySpan<U> out, Op op)
+	{
+		if (out.size() < in.size())
+			throw typename MySpan<U>::out_of_bounds("Output range is smaller than the input range");
+		size_t count = in.size();
+		if (count == 0)
+			return;
+		T* source = in.data();
+		U* target = out.data();
+
+		size_t blocks = pool.concurrency() * 4;
+		if (count < blocks * ParallelDetail::minGrain)
+			blocks = 1;
+		size_t blockSize = (count + blocks - 1) / blocks;
+		blocks = (count + blockSize - 1) / blockSize;
+
+		pool.parallel_for(blocks, 1, [&](size_t firstBlock, size_t lastBlock, size_t) {
+			for (size_t block = firstBlock; block < lastBlock; block++)
+			{
+				size_t first = block * blockSize;
+				size_t last = first + blockSize < count ? first + blockSize : count;
+				target[first] = source[first];
+				for (size_t i = first + 1; i < last; i++)
+					target[i] = op(target[i - 1], source[i]);
+			}
+		});
+		if (blocks == 1)
+			return;
+
+		//carries[b] is the total of every block before b
+		std::unique_ptr<U[]> carries(new U[blocks]);
+		carries[1] = target[blockSize - 1];
+		for (size_t block = 2; block < blocks; block++)
+			carries[block] = op(carries[block - 1], target[block * blockSize - 1]);
+
+		pool.parallel_for(blocks - 1, 1, [&](size_t firstBlock, size_t lastBlock, size_t) {
+			for (size_t block = firstBlock + 1; block < lastBlock + 1; block++)
+			{
+				size_t first = block * blockSize;
+				size_t last = first + blockSize < count ? first + blockSize : count;
+				for (size_t i = first; i < last; i++)
+					target[i] = op(carries[block], target[i]);
+			}
+		});
+	}
+	template<typename T, typename U, typename Op>
+	void par_inclusive_scan(MyThreadPool& pool, const MyVector<T>& in, MyVector<U>& out, Op op)
+	{
+		par_inclusive_scan(pool, MySpan<const T>(in), MySpan<U>(out), op);
+	}
+	template<typename T, typename U, typename Op>
+	void par_inclusive_scan(MySpan<T> in, MySpan<U> out, Op op)
+	{
+		par_inclusive_scan(MyThreadPool::shared(), in, out, op);
+	}
+	template<typename T, typename U, typename Op>
+	void par_inclusive_scan(const MyVector<T>& in, MyVector<U>& out, Op op)
+	{
+		par_inclusive_scan(MyThreadPool::shared(), MySpan<const T>(in), MySpan<U>(out), op);
+	}
+}
\ No newline at end of file
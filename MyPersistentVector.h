@@ -0,0 +1,705 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <iterator>
+#include <atomic>
+#include <utility>
+#include <new>
+#include <cstdint>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//immutable vector, every change returns a new version that shares all untouched nodes with the old one.
+	//elements live in a trie of 32 wide nodes whose leaves hold 32 elements, the last up to 32 elements
+	//are kept in a separate tail leaf so push_back and pop_back mostly touch only that.
+	//a Transient edits nodes it created itself in place and copies the others, for cheap batch changes.
+	//versions can be read and changed on different threads, nodes are reference counted atomically
+	template<typename T>
+	class MyPersistentVector
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("PersistentVector exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using value_type = T;
+	private:
+		static constexpr size_t bits = 5;
+		static constexpr size_t width = size_t(1) << bits;
+		static constexpr size_t mask = width - 1;
+
+		struct Node
+		{
+			std::atomic<size_t> refs;
+			uint64_t owner; //id of the transient that may change the node in place, 0 for none
+		};
+		struct Branch : Node
+		{
+			Node* children[width];
+		};
+		struct Leaf : Node
+		{
+			size_t count;
+			alignas(T) unsigned char storage[sizeof(T) * width];
+
+			T* values()
+			{
+				return std::launder(reinterpret_cast<T*>(storage));
+			}
+		};
+	public:
+		//random access over the elements, caches the leaf of the current position
+		class const_iterator
+		{
+		public:
+			using value_type = T;
+			using reference = const T&;
+			using pointer = const T*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+		private:
+			friend class MyPersistentVector;
+
+			const MyPersistentVector* vec;
+			size_t index;
+			mutable const T* leafValues;
+			mutable size_t leafBase;
+
+			const_iterator(const MyPersistentVector* vec, size_t index)
+				:
+				vec(vec),
+				index(index),
+				leafValues(nullptr),
+				leafBase(0)
+			{}
+		public:
+			reference operator*() const
+			{
+				if (index >= vec->count)
+					throw out_of_bounds("Tried to dereference end iterator");
+				if (leafValues == nullptr || leafBase != (index & ~mask))
+				{
+					leafBase = index & ~mask;
+					leafValues = vec->_leafFor(index)->values();
+				}
+				return leafValues[index & mask];
+			}
+			pointer operator->() const
+			{
+				return &**this;
+			}
+			reference operator[](difference_type n) const
+			{
+				return (*vec)[index + n];
+			}
+
+			const_iterator& operator++()
+			{
+				if (++index > vec->count)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				return *this;
+			}
+			const_iterator operator++(int)
+			{
+				const_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			const_iterator& operator--()
+			{
+				if (index-- == 0)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				return *this;
+			}
+			const_iterator operator--(int)
+			{
+				const_iterator result(*this);
+				--(*this);
+				return result;
+			}
+			const_iterator& operator+=(difference_type n)
+			{
+				if (n > 0 ? index + n > vec->count : size_t(-n) > index)
+					throw out_of_bounds("Tried to move iterator out of bounds");
+				index += n;
+				return *this;
+			}
+			const_iterator& operator-=(difference_type n)
+			{
+				return *this += -n;
+			}
+			const_iterator operator+(difference_type n) const
+			{
+				const_iterator result(*this);
+				return result += n;
+			}
+			const_iterator operator-(difference_type n) const
+			{
+				const_iterator result(*this);
+				return result -= n;
+			}
+			difference_type operator-(const const_iterator& other) const
+			{
+				_validateCompare(other);
+				return difference_type(index) - difference_type(other.index);
+			}
+
+			bool operator==(const const_iterator& other) const
+			{
+				_validateCompare(other);
+				return index == other.index;
+			}
+			bool operator!=(const const_iterator& other) const
+			{
+				return !(*this == other);
+			}
+			bool operator<(const const_iterator& other) const
+			{
+				_validateCompare(other);
+				return index < other.index;
+			}
+			bool operator>(const const_iterator& other) const
+			{
+				return other < *this;
+			}
+			bool operator<=(const const_iterator& other) const
+			{
+				return !(other < *this);
+			}
+			bool operator>=(const const_iterator& other) const
+			{
+				return !(*this < other);
+			}
+		private:
+			void _validateCompare(const const_iterator& other) const
+			{
+				if (vec != other.vec)
+					throw bad_iterator("Tried to compare iterators of different vectors");
+			}
+		};
+		using iterator = const_iterator;
+
+		//mutable working copy of a version, changes happen in place on nodes it created.
+		//persistent() hands the result out as a new version and ends the transient
+		class Transient
+		{
+		private:
+			friend class MyPersistentVector;
+
+			MyPersistentVector vec;
+			uint64_t owner;
+
+			Transient(const MyPersistentVector& source)
+				:
+				vec(source),
+				owner(_nextOwner())
+			{}
+		public:
+			Transient(Transient&& donor) noexcept
+				:
+				vec(std::move(donor.vec)),
+				owner(donor.owner)
+			{
+				donor.owner = 0;
+			}
+			Transient(const Transient&) = delete;
+			Transient& operator=(const Transient&) = delete;
+
+			const T& operator[](size_t index) const
+			{
+				_validate();
+				return vec[index];
+			}
+			size_t size() const
+			{
+				_validate();
+				return vec.count;
+			}
+			Transient& push_back(const T& val)
+			{
+				_validate();
+				vec._pushBack(val, owner);
+				return *this;
+			}
+			Transient& set(size_t index, const T& val)
+			{
+				_validate();
+				vec._set(index, val, owner);
+				return *this;
+			}
+			Transient& pop_back()
+			{
+				_validate();
+				vec._popBack(owner);
+				return *this;
+			}
+			MyPersistentVector persistent()
+			{
+				_validate();
+				owner = 0;
+				return std::move(vec);
+			}
+		private:
+			void _validate() const
+			{
+				if (owner == 0)
+					throw exception("Tried to use a transient after persistent()");
+			}
+		};
+	private:
+		size_t count;
+		size_t shift; //level of the root, the leaves are level 0
+		Node* root; //branch above the leaves in front of the tail, nullptr while everything fits in the tail
+		Leaf* tail; //nullptr while empty
+	public:
+		MyPersistentVector()
+			:
+			count(0),
+			shift(bits),
+			root(nullptr),
+			tail(nullptr)
+		{}
+		MyPersistentVector(std::initializer_list<T> list)
+			:
+			MyPersistentVector()
+		{
+			Transient edit = transient();
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				edit.push_back(*it);
+			*this = edit.persistent();
+		}
+		explicit MyPersistentVector(const MyVector<T>& vec)
+			:
+			MyPersistentVector()
+		{
+			Transient edit = transient();
+			for (size_t i = 0; i < vec.size(); i++)
+				edit.push_back(vec[i]);
+			*this = edit.persistent();
+		}
+		//O(1), the versions share every node
+		MyPersistentVector(const MyPersistentVector& copy)
+			:
+			count(copy.count),
+			shift(copy.shift),
+			root(copy.root),
+			tail(copy.tail)
+		{
+			_retain(root);
+			_retain(tail);
+		}
+		MyPersistentVector(MyPersistentVector&& donor) noexcept
+			:
+			MyPersistentVector()
+		{
+			swap(donor);
+		}
+		~MyPersistentVector()
+		{
+			_release(root, shift);
+			_release(tail, 0);
+		}
+
+		MyPersistentVector& operator=(const MyPersistentVector& copy)
+		{
+			if (&copy != this)
+			{
+				MyPersistentVector temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyPersistentVector& operator=(MyPersistentVector&& donor) noexcept
+		{
+			if (&donor != this)
+			{
+				MyPersistentVector temp(std::move(donor));
+				swap(temp);
+			}
+			return *this;
+		}
+		void swap(MyPersistentVector& other) noexcept
+		{
+			std::swap(count, other.count);
+			std::swap(shift, other.shift);
+			std::swap(root, other.root);
+			std::swap(tail, other.tail);
+		}
+
+		const T& operator[](size_t index) const
+		{
+			if (index >= count)
+				throw out_of_bounds();
+			return _leafFor(index)->values()[index & mask];
+		}
+		const T& at(size_t index) const
+		{
+			return (*this)[index];
+		}
+		const T& front() const
+		{
+			if (count == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return (*this)[0];
+		}
+		const T& back() const
+		{
+			if (count == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return tail->values()[tail->count - 1];
+		}
+		size_t size() const
+		{
+			return count;
+		}
+		bool empty() const
+		{
+			return count == 0;
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this, 0);
+		}
+		const_iterator end() const
+		{
+			return const_iterator(this, count);
+		}
+		const_iterator cbegin() const
+		{
+			return begin();
+		}
+		const_iterator cend() const
+		{
+			return end();
+		}
+
+		//new versions, this one stays unchanged
+		MyPersistentVector push_back(const T& val) const
+		{
+			MyPersistentVector result(*this);
+			result._pushBack(val, 0);
+			return result;
+		}
+		MyPersistentVector set(size_t index, const T& val) const
+		{
+			MyPersistentVector result(*this);
+			result._set(index, val, 0);
+			return result;
+		}
+		MyPersistentVector pop_back() const
+		{
+			MyPersistentVector result(*this);
+			result._popBack(0);
+			return result;
+		}
+		Transient transient() const
+		{
+			return Transient(*this);
+		}
+
+		//execute the lambda taking each element as parameter, one leaf at a time
+		template<typename Func>
+		void forEach(Func lambda) const
+		{
+			for (size_t base = 0; base < count; base += width)
+			{
+				Leaf* leaf = _leafFor(base);
+				T* values = leaf->values();
+				for (size_t i = 0; i < leaf->count; i++)
+					lambda(values[i]);
+			}
+		}
+		MyVector<T> toVector() const
+		{
+			MyVector<T> vec;
+			vec.reserve(count);
+			forEach([&](const T& val) { vec.push_back(val); });
+			return vec;
+		}
+	private:
+		static uint64_t _nextOwner()
+		{
+			static std::atomic<uint64_t> lastOwner(0);
+			return lastOwner.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+		//index of the first element in the tail
+		size_t _tailOffset() const
+		{
+			return count <= width ? 0 : ((count - 1) >> bits) << bits;
+		}
+		Leaf* _leafFor(size_t index) const
+		{
+			if (index >= _tailOffset())
+				return tail;
+			Node* node = root;
+			for (size_t level = shift; level > 0; level -= bits)
+				node = static_cast<Branch*>(node)->children[(index >> level) & mask];
+			return static_cast<Leaf*>(node);
+		}
+
+		static Branch* _newBranch(uint64_t owner)
+		{
+			Branch* branch = new Branch;
+			branch->refs.store(1, std::memory_order_relaxed);
+			branch->owner = owner;
+			for (size_t i = 0; i < width; i++)
+				branch->children[i] = nullptr;
+			return branch;
+		}
+		static Leaf* _newLeaf(uint64_t owner)
+		{
+			Leaf* leaf = new Leaf;
+			leaf->refs.store(1, std::memory_order_relaxed);
+			leaf->owner = owner;
+			leaf->count = 0;
+			return leaf;
+		}
+		static void _retain(Node* node)
+		{
+			if (node != nullptr)
+				node->refs.fetch_add(1, std::memory_order_relaxed);
+		}
+		static void _release(Node* node, size_t level)
+		{
+			if (node == nullptr || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+			if (level == 0)
+			{
+				Leaf* leaf = static_cast<Leaf*>(node);
+				T* values = leaf->values();
+				for (size_t i = 0; i < leaf->count; i++)
+					values[i].~T();
+				delete leaf;
+			}
+			else
+			{
+				Branch* branch = static_cast<Branch*>(node);
+				for (size_t i = 0; i < width; i++)
+					_release(branch->children[i], level - bits);
+				delete branch;
+			}
+		}
+
+		//the node in slot if owner may change it, otherwise a copy of it that replaces it in slot
+		static Branch* _editableBranch(Node*& slot, size_t level, uint64_t owner)
+		{
+			Branch* branch = static_cast<Branch*>(slot);
+			if (owner != 0 && branch->owner == owner)
+				return branch;
+			Branch* copy = _newBranch(owner);
+			for (size_t i = 0; i < width; i++)
+			{
+				copy->children[i] = branch->children[i];
+				_retain(copy->children[i]);
+			}
+			//if the old branch dies with our reference, its references to the children go with it
+			slot = copy;
+			_release(branch, level);
+			return copy;
+		}
+		static Leaf* _editableLeaf(Node*& slot, uint64_t owner)
+		{
+			Leaf* leaf = static_cast<Leaf*>(slot);
+			if (owner != 0 && leaf->owner == owner)
+				return leaf;
+			Leaf* copy = _newLeaf(owner);
+			T* from = leaf->values();
+			T* to = copy->values();
+			try
+			{
+				for (; copy->count < leaf->count; copy->count++)
+					new (to + copy->count) T(from[copy->count]);
+			}
+			catch (...)
+			{
+				_release(copy, 0);
+				throw;
+			}
+			slot = copy;
+			_release(leaf, 0);
+			return copy;
+		}
+		void _pushBack(const T& val, uint64_t owner)
+		{
+			size_t tailCount = count - _tailOffset();
+			if (tail != nullptr && tailCount < width)
+			{
+				Node* slot = tail;
+				Leaf* editable = _editableLeaf(slot, owner);
+				tail = editable;
+				new (editable->values() + editable->count) T(val);
+				editable->count++;
+				count++;
+				return;
+			}
+			Leaf* newTail = _newLeaf(owner);
+			try
+			{
+				new (newTail->values()) T(val);
+			}
+			catch (...)
+			{
+				_release(newTail, 0);
+				throw;
+			}
+			newTail->count = 1;
+			if (tail != nullptr)
+			{
+				//the full tail moves into the trie, a new level on top once the root is full
+				if (root == nullptr)
+				{
+					root = _newBranch(owner);
+				}
+				else if ((count >> bits) > (size_t(1) << shift))
+				{
+					Branch* newRoot = _newBranch(owner);
+					newRoot->children[0] = root;
+					newRoot->children[1] = _newPath(shift, tail, owner);
+					root = newRoot;
+					shift += bits;
+					tail = newTail;
+					count++;
+					return;
+				}
+				_pushTail(root, shift, tail, owner);
+			}
+			tail = newTail;
+			count++;
+		}
+		void _pushTail(Node*& slot, size_t level, Leaf* full, uint64_t owner)
+		{
+			Branch* branch = _editableBranch(slot, level, owner);
+			size_t subIndex = ((count - 1) >> level) & mask;
+			if (level == bits)
+				branch->children[subIndex] = full;
+			else if (branch->children[subIndex] != nullptr)
+				_pushTail(branch->children[subIndex], level - bits, full, owner);
+			else
+				branch->children[subIndex] = _newPath(level - bits, full, owner);
+		}
+		static Node* _newPath(size_t level, Leaf* leaf, uint64_t owner)
+		{
+			if (level == 0)
+				return leaf;
+			Branch* branch = _newBranch(owner);
+			branch->children[0] = _newPath(level - bits, leaf, owner);
+			return branch;
+		}
+
+		void _set(size_t index, const T& val, uint64_t owner)
+		{
+			if (index >= count)
+				throw out_of_bounds();
+			T copy(val);
+			if (index >= _tailOffset())
+			{
+				Node* slot = tail;
+				tail = _editableLeaf(slot, owner);
+				tail->values()[index & mask] = std::move(copy);
+				return;
+			}
+			Node** slot = &root;
+			for (size_t level = shift; level > 0; level -= bits)
+				slot = &_editableBranch(*slot, level, owner)->children[(index >> level) & mask];
+			_editableLeaf(*slot, owner)->values()[index & mask] = std::move(copy);
+		}
+
+		void _popBack(uint64_t owner)
+		{
+			if (count == 0)
+				throw out_of_bounds("Tried to pop from an empty vector");
+			if (count - _tailOffset() > 1)
+			{
+				Node* slot = tail;
+				tail = _editableLeaf(slot, owner);
+				tail->values()[--tail->count].~T();
+				count--;
+				return;
+			}
+			if (count == 1)
+			{
+				_release(tail, 0);
+				tail = nullptr;
+				count = 0;
+				return;
+			}
+			//the tail is down to one element, the last leaf of the trie becomes the new tail
+			Leaf* newTail = _leafFor(count - 2);
+			_retain(newTail);
+			_release(tail, 0);
+			_popTail(root, shift, owner);
+			if (root == nullptr)
+			{
+				shift = bits;
+			}
+			else if (shift > bits && static_cast<Branch*>(root)->children[1] == nullptr)
+			{
+				Node* newRoot = static_cast<Branch*>(root)->children[0];
+				_retain(newRoot);
+				_release(root, shift);
+				root = newRoot;
+				shift -= bits;
+			}
+			tail = newTail;
+			count--;
+		}
+		//removes the leaf of element count - 2 below slot, releases and clears slot when nothing else is left in it
+		void _popTail(Node*& slot, size_t level, uint64_t owner)
+		{
+			if ((((count - 2) >> bits) & ((size_t(1) << level) - 1)) == 0)
+			{
+				_release(slot, level);
+				slot = nullptr;
+				return;
+			}
+			Branch* branch = _editableBranch(slot, level, owner);
+			size_t subIndex = ((count - 2) >> level) & mask;
+			if (level == bits)
+			{
+				_release(branch->children[subIndex], 0);
+				branch->children[subIndex] = nullptr;
+			}
+			else
+			{
+				_popTail(branch->children[subIndex], level - bits, owner);
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,510 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <algorithm>
+#include <utility>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//sequence for large buffers that are edited in the middle, stored as an AVL tree whose leaves are MyVector chunks of up to 4 KiB.
+	//inner nodes only know the number of elements below them, so a position is found in O(log n).
+	//everything is built on joining two trees and splitting one at a position, both O(log n), edits that fit into one chunk skip them
+	template<typename T>
+	class MyRope
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("Rope exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+	private:
+		static constexpr size_t maxChunk = 4096 / sizeof(T) > 16 ? 4096 / sizeof(T) : 16;
+		//an AVL tree of n chunks is at most 1.44 log2(n) high
+		static constexpr size_t maxHeight = 96;
+
+		//a leaf has no children and keeps its elements in chunk, inner nodes leave chunk empty
+		struct Node
+		{
+			Node* left;
+			Node* right;
+			size_t v_size; //elements below
+			size_t height; //0 for leaves
+			MyVector<T> chunk;
+		};
+
+		Node* root;
+	public:
+		MyRope()
+			:
+			root(nullptr)
+		{}
+		MyRope(const T* data, size_t count)
+			:
+			root(count == 0 ? nullptr : _build(data, count))
+		{}
+		explicit MyRope(const MyVector<T>& vec)
+			:
+			MyRope(vec.getData(), vec.size())
+		{}
+		MyRope(std::initializer_list<T> list)
+			:
+			MyRope(list.begin(), list.size())
+		{}
+		MyRope(const MyRope& copy)
+			:
+			root(copy.root == nullptr ? nullptr : _clone(copy.root))
+		{}
+		MyRope(MyRope&& donor) noexcept
+			:
+			root(donor.root)
+		{
+			donor.root = nullptr;
+		}
+		~MyRope()
+		{
+			_destroy(root);
+		}
+
+		MyRope& operator=(const MyRope& copy)
+		{
+			if (this != &copy)
+			{
+				MyRope temp(copy);
+				swap(temp);
+			}
+			return *this;
+		}
+		MyRope& operator=(MyRope&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				_destroy(root);
+				root = donor.root;
+				donor.root = nullptr;
+			}
+			return *this;
+		}
+		void swap(MyRope& other) noexcept
+		{
+			std::swap(root, other.root);
+		}
+
+		size_t size() const
+		{
+			return _size(root);
+		}
+		bool empty() const
+		{
+			return root == nullptr;
+		}
+		void clear()
+		{
+			_destroy(root);
+			root = nullptr;
+		}
+
+		T& operator[](size_t index)
+		{
+			if (index >= size())
+				throw out_of_bounds();
+			Node* node = root;
+			while (node->left != nullptr)
+			{
+				if (index < node->left->v_size)
+				{
+					node = node->left;
+				}
+				else
+				{
+					index -= node->left->v_size;
+					node = node->right;
+				}
+			}
+			return node->chunk.getData()[index];
+		}
+		const T& operator[](size_t index) const
+		{
+			return const_cast<MyRope*>(this)->operator[](index);
+		}
+
+		void insert(size_t position, const T* data, size_t count)
+		{
+			if (position > size())
+				throw out_of_bounds("Tried to insert out of bounds");
+			if (count == 0 || _insertInChunk(position, data, count))
+				return;
+			Node* middle = _build(data, count);
+			std::pair<Node*, Node*> parts = _split(root, position);
+			root = _join(_join(parts.first, middle), parts.second);
+		}
+		void insert(size_t position, const MyVector<T>& vec)
+		{
+			insert(position, vec.getData(), vec.size());
+		}
+		//moves the elements of other into this rope without copying them
+		void insert(size_t position, MyRope&& other)
+		{
+			if (position > size())
+				throw out_of_bounds("Tried to insert out of bounds");
+			if (this == &other)
+				return;
+			std::pair<Node*, Node*> parts = _split(root, position);
+			root = _join(_join(parts.first, other.root), parts.second);
+			other.root = nullptr;
+		}
+		void append(const T* data, size_t count)
+		{
+			insert(size(), data, count);
+		}
+		void push_back(const T& val)
+		{
+			insert(size(), &val, 1);
+		}
+		//takes the elements of other, joining the trees costs the difference of their heights
+		void concat(MyRope&& other)
+		{
+			if (this == &other)
+				return;
+			root = _join(root, other.root);
+			other.root = nullptr;
+		}
+		MyRope& operator+=(MyRope&& other)
+		{
+			concat(std::move(other));
+			return *this;
+		}
+		MyRope& operator+=(const MyRope& other)
+		{
+			MyRope copy(other);
+			concat(std::move(copy));
+			return *this;
+		}
+
+		void erase(size_t position, size_t count)
+		{
+			if (position > size() || count > size() - position)
+				throw out_of_bounds("Tried to erase out of bounds");
+			if (count == 0 || _eraseInChunk(position, count))
+				return;
+			std::pair<Node*, Node*> front = _split(root, position);
+			std::pair<Node*, Node*> back = _split(front.second, count);
+			_destroy(back.first);
+			root = _join(front.first, back.second);
+		}
+		//keeps the elements before position and returns the rest as a new rope
+		MyRope split(size_t position)
+		{
+			if (position > size())
+				throw out_of_bounds("Tried to split out of bounds");
+			std::pair<Node*, Node*> parts = _split(root, position);
+			root = parts.first;
+			MyRope result;
+			result.root = parts.second;
+			return result;
+		}
+
+		//calls func(data, count) for each chunk in order, for handing the buffer to writev or similar without copying
+		template<typename Func>
+		void forEachChunk(Func func) const
+		{
+			_forEachChunk(root, func);
+		}
+		//calls func(element) for every element in order
+		template<typename Func>
+		void forEach(Func func) const
+		{
+			auto visit = [&func](const T* data, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+					func(data[i]);
+			};
+			_forEachChunk(root, visit);
+		}
+		MyVector<T> flatten() const
+		{
+			MyVector<T> result;
+			result.reserve(size());
+			result.resize(size());
+			T* target = result.getData();
+			auto copy = [&target](const T* data, size_t count)
+			{
+				target = std::copy(data, data + count, target);
+			};
+			_forEachChunk(root, copy);
+			return result;
+		}
+	private:
+		static size_t _size(const Node* node)
+		{
+			return node == nullptr ? 0 : node->v_size;
+		}
+		static Node* _leaf(MyVector<T>&& chunk)
+		{
+			size_t count = chunk.size();
+			return new Node{ nullptr, nullptr, count, 0, std::move(chunk) };
+		}
+		static Node* _inner(Node* left, Node* right)
+		{
+			Node* node = new Node{ left, right, 0, 0, MyVector<T>() };
+			_update(node);
+			return node;
+		}
+		static void _update(Node* node)
+		{
+			node->v_size = node->left->v_size + node->right->v_size;
+			node->height = std::max(node->left->height, node->right->height) + 1;
+		}
+		//chunks as full as possible, halved by chunk count so the tree is balanced
+		static Node* _build(const T* data, size_t count)
+		{
+			if (count <= maxChunk)
+				return _leaf(MyVector<T>(data, data + count));
+			size_t chunks = (count + maxChunk - 1) / maxChunk;
+			size_t leftCount = chunks / 2 * maxChunk;
+			Node* left = _build(data, leftCount);
+			Node* right;
+			try
+			{
+				right = _build(data + leftCount, count - leftCount);
+			}
+			catch (...)
+			{
+				_destroy(left);
+				throw;
+			}
+			return _inner(left, right);
+		}
+		static Node* _clone(const Node* node)
+		{
+			if (node->left == nullptr)
+				return _leaf(MyVector<T>(node->chunk));
+			Node* left = _clone(node->left);
+			Node* right;
+			try
+			{
+				right = _clone(node->right);
+			}
+			catch (...)
+			{
+				_destroy(left);
+				throw;
+			}
+			return _inner(left, right);
+		}
+		static void _destroy(Node* node)
+		{
+			if (node == nullptr)
+				return;
+			_destroy(node->left);
+			_destroy(node->right);
+			delete node;
+		}
+		template<typename Func>
+		static void _forEachChunk(const Node* node, Func& func)
+		{
+			if (node == nullptr)
+				return;
+			if (node->left == nullptr)
+			{
+				func(node->chunk.getData(), node->chunk.size());
+				return;
+			}
+			_forEachChunk(node->left, func);
+			_forEachChunk(node->right, func);
+		}
+
+		static Node* _rotateLeft(Node* node)
+		{
+			Node* right = node->right;
+			node->right = right->left;
+			_update(node);
+			right->left = node;
+			_update(right);
+			return right;
+		}
+		static Node* _rotateRight(Node* node)
+		{
+			Node* left = node->left;
+			node->left = left->right;
+			_update(node);
+			left->right = node;
+			_update(left);
+			return left;
+		}
+		//children may differ in height by two after one of them changed
+		static Node* _rebalance(Node* node)
+		{
+			_update(node);
+			if (node->left->height > node->right->height + 1)
+			{
+				if (node->left->left->height < node->left->right->height)
+					node->left = _rotateLeft(node->left);
+				return _rotateRight(node);
+			}
+			if (node->right->height > node->left->height + 1)
+			{
+				if (node->right->right->height < node->right->left->height)
+					node->right = _rotateRight(node->right);
+				return _rotateLeft(node);
+			}
+			return node;
+		}
+		//all elements of left followed by all of right, walking down the spine of the higher tree to the height of the other
+		static Node* _join(Node* left, Node* right)
+		{
+			if (left == nullptr)
+				return right;
+			if (right == nullptr)
+				return left;
+			//two small neighbouring chunks become one, so splits and erases do not leave crumbs behind
+			if (left->left == nullptr && right->left == nullptr && left->v_size + right->v_size <= maxChunk)
+			{
+				_appendToChunk(left, right->chunk.getData(), right->v_size);
+				delete right;
+				return left;
+			}
+			if (left->height > right->height + 1)
+			{
+				left->right = _join(left->right, right);
+				return _rebalance(left);
+			}
+			if (right->height > left->height + 1)
+			{
+				right->left = _join(left, right->left);
+				return _rebalance(right);
+			}
+			return _inner(left, right);
+		}
+		//the elements before position and the rest, inner nodes on the way are dissolved and their children joined again
+		static std::pair<Node*, Node*> _split(Node* node, size_t position)
+		{
+			if (node == nullptr)
+				return std::make_pair(nullptr, nullptr);
+			if (position == 0)
+				return std::make_pair(nullptr, node);
+			if (position == node->v_size)
+				return std::make_pair(node, nullptr);
+			if (node->left == nullptr)
+			{
+				const T* data = node->chunk.getData();
+				Node* right = _leaf(MyVector<T>(data + position, data + node->v_size));
+				node->chunk.resize(position);
+				node->v_size = position;
+				return std::make_pair(node, right);
+			}
+			Node* left = node->left;
+			Node* right = node->right;
+			delete node;
+			if (position <= left->v_size)
+			{
+				std::pair<Node*, Node*> parts = _split(left, position);
+				return std::make_pair(parts.first, _join(parts.second, right));
+			}
+			std::pair<Node*, Node*> parts = _split(right, position - left->v_size);
+			return std::make_pair(_join(left, parts.first), parts.second);
+		}
+
+		static void _appendToChunk(Node* leaf, const T* data, size_t count)
+		{
+			_reserveChunk(leaf, leaf->v_size + count);
+			leaf->chunk.resize(leaf->v_size + count);
+			std::copy(data, data + count, leaf->chunk.getData() + leaf->v_size);
+			leaf->v_size += count;
+		}
+		//grows geometrically up to maxChunk, MyVector::reserve allocates exactly what it is asked for
+		static void _reserveChunk(Node* leaf, size_t needed)
+		{
+			size_t capacity = leaf->chunk.capacity();
+			if (capacity >= needed)
+				return;
+			size_t grown = std::min(std::max(capacity * 2, size_t(16)), maxChunk);
+			leaf->chunk.reserve(std::max(grown, needed));
+		}
+		//inserts directly into the chunk at position when it has room, shifting at most one chunk
+		bool _insertInChunk(size_t position, const T* data, size_t count)
+		{
+			if (root == nullptr || count > maxChunk)
+				return false;
+			Node* path[maxHeight];
+			size_t depth = 0;
+			Node* node = root;
+			while (node->left != nullptr)
+			{
+				path[depth++] = node;
+				if (position <= node->left->v_size)
+				{
+					node = node->left;
+				}
+				else
+				{
+					position -= node->left->v_size;
+					node = node->right;
+				}
+			}
+			size_t oldSize = node->v_size;
+			if (oldSize + count > maxChunk)
+				return false;
+			_reserveChunk(node, oldSize + count);
+			node->chunk.resize(oldSize + count);
+			T* chunk = node->chunk.getData();
+			std::move_backward(chunk + position, chunk + oldSize, chunk + oldSize + count);
+			std::copy(data, data + count, chunk + position);
+			node->v_size += count;
+			for (size_t i = 0; i < depth; i++)
+				path[i]->v_size += count;
+			return true;
+		}
+		//erases directly from a chunk that holds the whole range and keeps at least one element
+		bool _eraseInChunk(size_t position, size_t count)
+		{
+			Node* path[maxHeight];
+			size_t depth = 0;
+			Node* node = root;
+			while (node->left != nullptr)
+			{
+				path[depth++] = node;
+				if (position < node->left->v_size)
+				{
+					node = node->left;
+				}
+				else
+				{
+					position -= node->left->v_size;
+					node = node->right;
+				}
+			}
+			if (position + count > node->v_size || count == node->v_size)
+				return false;
+			T* chunk = node->chunk.getData();
+			std::move(chunk + position + count, chunk + node->v_size, chunk + position);
+			node->v_size -= count;
+			node->chunk.resize(node->v_size);
+			for (size_t i = 0; i < depth; i++)
+				path[i]->v_size -= count;
+			return true;
+		}
+	};
+}
\ No newline at end of file
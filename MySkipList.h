@@ -0,0 +1,626 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <new>
+#include <cstdint>
+#include "MyNodePool.h"
+
+namespace MySTL
+{
+	//ordered map on a skip list. every node carries a tower of forward links inline behind its payload,
+	//each tower height gets its own MyNodePool so nodes of one height are packed together.
+	//heights follow a geometric distribution with p = 1/4, the lowest level is doubly linked for bidirectional iteration
+	template<typename K, typename V, typename Comp = std::less<K>>
+	class MySkipList
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("SkipList exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* message)
+				:
+				exception(message)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* message)
+				:
+				exception(message)
+			{}
+		};
+
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<const K, V>;
+	private:
+		static constexpr size_t maxHeight = 16;
+
+		//the sentinels only need the links, so they carry no payload and live inside the list
+		struct NodeBase
+		{
+			NodeBase* prev;
+			NodeBase** next; //tower of height forward links, next[0] is the neighbour at the lowest level
+			size_t height;
+		};
+		struct Node : public NodeBase
+		{
+			value_type data;
+			template<typename KeyArg, typename... args>
+			Node(KeyArg&& key, args&&... vals)
+				:
+				NodeBase{ nullptr, nullptr, 0 },
+				data(std::piecewise_construct, std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<args>(vals)...))
+			{}
+		};
+		static constexpr size_t towerOffset = (sizeof(Node) + alignof(NodeBase*) - 1) / alignof(NodeBase*) * alignof(NodeBase*);
+		static constexpr size_t nodeAlign = alignof(Node) > alignof(NodeBase*) ? alignof(Node) : alignof(NodeBase*);
+		template<size_t Height>
+		using NodePool = MyNodePool<towerOffset + Height * sizeof(NodeBase*), nodeAlign>;
+	public:
+		class iterator
+		{
+		public:
+			using value_type = MySkipList::value_type;
+			using reference = value_type&;
+			using pointer = value_type*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::bidirectional_iterator_tag;
+		public:
+			class bad_iterator_compare : public exception
+			{
+			public:
+				bad_iterator_compare()
+					:
+					exception("Tried to compare false iterators")
+				{}
+				bad_iterator_compare(const char* message)
+					:
+					exception(message)
+				{}
+			};
+		private:
+			friend class MySkipList;
+
+			MySkipList* list;
+			NodeBase* node;
+		protected:
+			iterator(MySkipList* list, NodeBase* node)
+				:
+				list(list),
+				node(node)
+			{}
+		public:
+			reference operator*() const
+			{
+				if (node == &list->head || node == &list->tail)
+					throw out_of_bounds("Tried to dereference invalid element");
+				return _value(node);
+			}
+			pointer operator->() const
+			{
+				if (node == &list->head || node == &list->tail)
+					throw out_of_bounds("Tried to access invalid element");
+				return &_value(node);
+			}
+
+			iterator& operator++()
+			{
+				if (node == &list->tail)
+					throw out_of_bounds("Tried to increment iterator out of bounds");
+				node = node->next[0];
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator& operator--()
+			{
+				if (node->prev == &list->head)
+					throw out_of_bounds("Tried to decrement iterator out of bounds");
+				node = node->prev;
+				return *this;
+			}
+			iterator operator--(int)
+			{
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator& other) const
+			{
+				if (list == other.list)
+					return node == other.node;
+				else
+					throw bad_iterator_compare("Tried to compare iterators from different lists");
+			}
+			bool operator!=(const iterator& other) const
+			{
+				return !(*this == other);
+			}
+		};
+		class const_iterator : public iterator
+		{
+		private:
+			friend class MySkipList;
+		protected:
+			const_iterator(const MySkipList* list, NodeBase* node)
+				:
+				iterator(const_cast<MySkipList*>(list), node)
+			{}
+		public:
+			const value_type& operator*() const
+			{
+				return iterator::operator*();
+			}
+			const value_type* operator->() const
+			{
+				return iterator::operator->();
+			}
+		};
+		//the elements with keys in [lo, hi), two iterators found by one search each
+		template<class Iter>
+		class Range
+		{
+		private:
+			Iter first;
+			Iter last;
+		public:
+			Range(Iter first, Iter last)
+				:
+				first(first),
+				last(last)
+			{}
+			Iter begin() const
+			{
+				return first;
+			}
+			Iter end() const
+			{
+				return last;
+			}
+			bool empty() const
+			{
+				return first == last;
+			}
+		};
+	private:
+		friend class iterator;
+
+		NodeBase head; //one element before the first, links on every level
+		NodeBase tail; //one element after the last, every level ends here
+		NodeBase* headTower[maxHeight];
+		size_t height; //highest tower in the list, searches start there
+		size_t v_size;
+		uint64_t randomState;
+		Comp comp;
+	public:
+		MySkipList()
+			:
+			head{ nullptr, headTower, maxHeight },
+			tail{ &head, nullptr, 0 },
+			height(1),
+			v_size(0),
+			randomState(0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(this))
+		{
+			for (size_t i = 0; i < maxHeight; i++)
+				headTower[i] = &tail;
+		}
+		MySkipList(std::initializer_list<value_type> list)
+			:
+			MySkipList()
+		{
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				insert(it->first, it->second);
+		}
+		MySkipList(const MySkipList& copy)
+			:
+			MySkipList()
+		{
+			_appendCopy(copy);
+		}
+		MySkipList(MySkipList&& donor) noexcept
+			:
+			MySkipList()
+		{
+			_takeNodes(donor);
+		}
+		~MySkipList()
+		{
+			clear();
+		}
+
+		MySkipList& operator=(const MySkipList& copy)
+		{
+			if (this != &copy)
+			{
+				clear();
+				_appendCopy(copy);
+			}
+			return *this;
+		}
+		MySkipList& operator=(MySkipList&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				clear();
+				_takeNodes(donor);
+			}
+			return *this;
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		void clear()
+		{
+			for (NodeBase* node = head.next[0]; node != &tail;)
+			{
+				NodeBase* next = node->next[0];
+				_destroyNode(node);
+				node = next;
+			}
+			for (size_t i = 0; i < maxHeight; i++)
+				headTower[i] = &tail;
+			tail.prev = &head;
+			height = 1;
+			v_size = 0;
+		}
+
+		iterator begin()
+		{
+			return iterator(this, head.next[0]);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, head.next[0]);
+		}
+		iterator end()
+		{
+			return iterator(this, &tail);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, const_cast<NodeBase*>(&tail));
+		}
+		value_type& front()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty list");
+			return _value(head.next[0]);
+		}
+		value_type& back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty list");
+			return _value(tail.prev);
+		}
+
+		//does nothing if the key is already in the list
+		template<typename KeyArg, typename... args>
+		std::pair<iterator, bool> try_emplace(KeyArg&& key, args&&... vals)
+		{
+			NodeBase* update[maxHeight];
+			NodeBase* found = _findPredecessors(key, update);
+			if (found != &tail && !comp(key, _key(found)))
+				return std::make_pair(iterator(this, found), false);
+			size_t nodeHeight = _randomHeight();
+			NodeBase* node = _createNode(nodeHeight, std::forward<KeyArg>(key), std::forward<args>(vals)...);
+			for (size_t level = height; level < nodeHeight; level++)
+				update[level] = &head;
+			if (nodeHeight > height)
+				height = nodeHeight;
+			_link(node, update);
+			return std::make_pair(iterator(this, node), true);
+		}
+		std::pair<iterator, bool> insert(const K& key, const V& val)
+		{
+			return try_emplace(key, val);
+		}
+		std::pair<iterator, bool> insert(const value_type& val)
+		{
+			return try_emplace(val.first, val.second);
+		}
+		std::pair<iterator, bool> insert_or_assign(const K& key, const V& val)
+		{
+			std::pair<iterator, bool> result = try_emplace(key, val);
+			if (!result.second)
+				result.first->second = val;
+			return result;
+		}
+		V& operator[](const K& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		V& at(const K& key)
+		{
+			NodeBase* node = _find(key);
+			if (node == &tail)
+				throw out_of_bounds("Tried to access key that is not in the list");
+			return _value(node).second;
+		}
+		const V& at(const K& key) const
+		{
+			return const_cast<MySkipList*>(this)->at(key);
+		}
+		iterator find(const K& key)
+		{
+			return iterator(this, _find(key));
+		}
+		const_iterator find(const K& key) const
+		{
+			return const_iterator(this, _find(key));
+		}
+		bool contains(const K& key) const
+		{
+			return _find(key) != &tail;
+		}
+		size_t count(const K& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+		//first element whose key is not less than key
+		iterator lower_bound(const K& key)
+		{
+			return iterator(this, _lowerBound(key));
+		}
+		const_iterator lower_bound(const K& key) const
+		{
+			return const_iterator(this, _lowerBound(key));
+		}
+		//first element whose key is greater than key
+		iterator upper_bound(const K& key)
+		{
+			NodeBase* node = _lowerBound(key);
+			if (node != &tail && !comp(key, _key(node)))
+				node = node->next[0];
+			return iterator(this, node);
+		}
+		//the elements with keys in [lo, hi) to iterate over without allocating, empty if hi is not greater than lo
+		Range<iterator> range(const K& lo, const K& hi)
+		{
+			NodeBase* first = _lowerBound(lo);
+			NodeBase* last = comp(lo, hi) ? _lowerBound(hi) : first;
+			return Range<iterator>(iterator(this, first), iterator(this, last));
+		}
+		Range<const_iterator> range(const K& lo, const K& hi) const
+		{
+			NodeBase* first = _lowerBound(lo);
+			NodeBase* last = comp(lo, hi) ? _lowerBound(hi) : first;
+			return Range<const_iterator>(const_iterator(this, first), const_iterator(this, last));
+		}
+
+		size_t erase(const K& key)
+		{
+			NodeBase* update[maxHeight];
+			NodeBase* found = _findPredecessors(key, update);
+			if (found == &tail || comp(key, _key(found)))
+				return 0;
+			_unlink(found, update);
+			_destroyNode(found);
+			return 1;
+		}
+		//returns the iterator to the element after the erased one
+		iterator erase(iterator position)
+		{
+			if (position.list != this)
+				throw bad_iterator("Tried to pass iterator from different list");
+			if (position.node == &head || position.node == &tail)
+				throw out_of_bounds("Tried to erase invalid element");
+			NodeBase* node = position.node;
+			NodeBase* next = node->next[0];
+			NodeBase* update[maxHeight];
+			_findPredecessors(_key(node), update);
+			_unlink(node, update);
+			_destroyNode(node);
+			return iterator(this, next);
+		}
+	private:
+		static value_type& _value(NodeBase* node)
+		{
+			return static_cast<Node*>(node)->data;
+		}
+		static const K& _key(NodeBase* node)
+		{
+			return static_cast<Node*>(node)->data.first;
+		}
+
+		//first node whose key is not less than key, update gets the last node before it on every level below height
+		template<typename Key>
+		NodeBase* _findPredecessors(const Key& key, NodeBase** update)
+		{
+			NodeBase* node = &head;
+			for (size_t level = height; level-- > 0;)
+			{
+				NodeBase* next = node->next[level];
+				while (next != &tail && comp(_key(next), key))
+				{
+					node = next;
+					next = node->next[level];
+				}
+				update[level] = node;
+			}
+			return node->next[0];
+		}
+		NodeBase* _lowerBound(const K& key) const
+		{
+			const NodeBase* node = &head;
+			for (size_t level = height; level-- > 0;)
+			{
+				NodeBase* next = node->next[level];
+				while (next != &tail && comp(_key(next), key))
+				{
+					node = next;
+					next = node->next[level];
+				}
+			}
+			return node->next[0];
+		}
+		NodeBase* _find(const K& key) const
+		{
+			NodeBase* node = _lowerBound(key);
+			if (node != &tail && comp(key, _key(node)))
+				return const_cast<NodeBase*>(&tail);
+			return node;
+		}
+
+		void _link(NodeBase* node, NodeBase** update)
+		{
+			for (size_t level = 0; level < node->height; level++)
+			{
+				node->next[level] = update[level]->next[level];
+				update[level]->next[level] = node;
+			}
+			node->prev = update[0];
+			node->next[0]->prev = node;
+			v_size++;
+		}
+		void _unlink(NodeBase* node, NodeBase** update)
+		{
+			for (size_t level = 0; level < node->height; level++)
+				update[level]->next[level] = node->next[level];
+			node->next[0]->prev = node->prev;
+			while (height > 1 && head.next[height - 1] == &tail)
+				height--;
+			v_size--;
+		}
+
+		//xorshift, two zero bits per extra level
+		size_t _randomHeight()
+		{
+			randomState ^= randomState << 13;
+			randomState ^= randomState >> 7;
+			randomState ^= randomState << 17;
+			uint64_t bits = randomState;
+			size_t nodeHeight = 1;
+			while ((bits & 3) == 0 && nodeHeight < maxHeight)
+			{
+				nodeHeight++;
+				bits >>= 2;
+			}
+			return nodeHeight;
+		}
+
+		template<typename... args>
+		static NodeBase* _createNode(size_t nodeHeight, args&&... vals)
+		{
+			void* memory = _allocate(nodeHeight, std::make_index_sequence<maxHeight>());
+			Node* node;
+			try
+			{
+				node = new (memory) Node(std::forward<args>(vals)...);
+			}
+			catch (...)
+			{
+				_deallocate(memory, nodeHeight, std::make_index_sequence<maxHeight>());
+				throw;
+			}
+			node->next = reinterpret_cast<NodeBase**>(static_cast<char*>(memory) + towerOffset);
+			node->height = nodeHeight;
+			return node;
+		}
+		static void _destroyNode(NodeBase* node)
+		{
+			size_t nodeHeight = node->height;
+			static_cast<Node*>(node)->~Node();
+			_deallocate(node, nodeHeight, std::make_index_sequence<maxHeight>());
+		}
+		//one pool per tower height, picked through a table of the pools' functions
+		template<size_t... Heights>
+		static void* _allocate(size_t nodeHeight, std::index_sequence<Heights...>)
+		{
+			static void* (*const allocators[])() = { &NodePool<Heights + 1>::allocate... };
+			return allocators[nodeHeight - 1]();
+		}
+		template<size_t... Heights>
+		static void _deallocate(void* memory, size_t nodeHeight, std::index_sequence<Heights...>)
+		{
+			static void (*const deallocators[])(void*) = { static_cast<void (*)(void*)>(&NodePool<Heights + 1>::deallocate)... };
+			deallocators[nodeHeight - 1](memory);
+		}
+
+		//copy is sorted already, so every node goes behind the last node of each of its levels without a search
+		void _appendCopy(const MySkipList& copy)
+		{
+			NodeBase* last[maxHeight];
+			for (size_t i = 0; i < maxHeight; i++)
+				last[i] = &head;
+			for (NodeBase* source = copy.head.next[0]; source != &copy.tail; source = source->next[0])
+			{
+				size_t nodeHeight = _randomHeight();
+				NodeBase* node = _createNode(nodeHeight, _key(source), _value(source).second);
+				if (nodeHeight > height)
+					height = nodeHeight;
+				_link(node, last);
+				for (size_t level = 0; level < nodeHeight; level++)
+					last[level] = node;
+			}
+		}
+		//the nodes link to the sentinels of donor, those links are moved over to ours
+		void _takeNodes(MySkipList& donor)
+		{
+			if (donor.v_size == 0)
+				return;
+			NodeBase* node = &head;
+			for (size_t level = donor.height; level-- > 0;)
+			{
+				headTower[level] = donor.headTower[level];
+				NodeBase* next = node->next[level];
+				while (next != &donor.tail)
+				{
+					node = next;
+					next = node->next[level];
+				}
+				if (node == &head)
+					headTower[level] = &tail;
+				else
+					node->next[level] = &tail;
+			}
+			headTower[0]->prev = &head;
+			tail.prev = donor.tail.prev;
+			height = donor.height;
+			v_size = donor.v_size;
+			for (size_t i = 0; i < maxHeight; i++)
+				donor.headTower[i] = &donor.tail;
+			donor.tail.prev = &donor.head;
+			donor.height = 1;
+			donor.v_size = 0;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <iterator>
+#include "MyVector.h"
+#include "MySpan.h"
+
+namespace MySTL
+{
+	//vector of rows whose fields are stored column by column, every field type gets its own contiguous MyVector.
+	//a scan over one field only touches that column, rows are accessed through tuples of references
+	template<typename... Fields>
+	class MySoAVector
+	{
+		static_assert(sizeof...(Fields) > 0, "MySoAVector needs at least one field");
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("SoAVector exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+
+		using value_type = std::tuple<Fields...>;
+		//writes through to the columns, assigning a value_type sets every field of the row
+		using reference = std::tuple<Fields&...>;
+		using const_reference = std::tuple<const Fields&...>;
+		template<size_t I>
+		using field_type = typename std::tuple_element<I, value_type>::type;
+	public:
+		//random access over the rows, dereferencing yields a reference proxy instead of a real reference
+		class iterator
+		{
+		public:
+			using value_type = MySoAVector::value_type;
+			using reference = MySoAVector::reference;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::random_access_iterator_tag;
+		private:
+			friend class MySoAVector;
+
+			MySoAVector* vec;
+			size_t row;
+
+			iterator(MySoAVector* vec, size_t row)
+				:
+				vec(vec),
+				row(row)
+			{}
+		public:
+			reference operator*() const
+			{
+				return (*vec)[row];
+			}
+			reference operator[](difference_type n) const
+			{
+				return (*vec)[row + n];
+			}
+
+			iterator& operator++()
+			{
+				if (++row > vec->v_size)
+					throw out_of_bounds("Tried to increment iterator past the end");
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator& operator--()
+			{
+				if (row-- == 0)
+					throw out_of_bounds("Tried to decrement iterator below the beginning");
+				return *this;
+			}
+			iterator operator--(int)
+			{
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+			iterator& operator+=(difference_type n)
+			{
+				if (n > 0 ? row + n > vec->v_size : size_t(-n) > row)
+					throw out_of_bounds("Tried to move iterator out of bounds");
+				row += n;
+				return *this;
+			}
+			iterator& operator-=(difference_type n)
+			{
+				return *this += -n;
+			}
+			iterator operator+(difference_type n) const
+			{
+				iterator result(*this);
+				return result += n;
+			}
+			iterator operator-(difference_type n) const
+			{
+				iterator result(*this);
+				return result -= n;
+			}
+			difference_type operator-(const iterator& other) const
+			{
+				_validateCompare(other);
+				return difference_type(row) - difference_type(other.row);
+			}
+
+			bool operator==(const iterator& other) const
+			{
+				_validateCompare(other);
+				return row == other.row;
+			}
+			bool operator!=(const iterator& other) const
+			{
+				return !(*this == other);
+			}
+			bool operator<(const iterator& other) const
+			{
+				_validateCompare(other);
+				return row < other.row;
+			}
+			bool operator>(const iterator& other) const
+			{
+				return other < *this;
+			}
+			bool operator<=(const iterator& other) const
+			{
+				return !(other < *this);
+			}
+			bool operator>=(const iterator& other) const
+			{
+				return !(*this < other);
+			}
+		private:
+			void _validateCompare(const iterator& other) const
+			{
+				if (vec != other.vec)
+					throw bad_iterator("Tried to compare iterators of different vectors");
+			}
+		};
+	private:
+		friend class iterator;
+
+		std::tuple<MyVector<Fields>...> columns;
+		size_t v_size;
+	public:
+		MySoAVector()
+			:
+			v_size(0)
+		{}
+
+		reference operator[](size_t row)
+		{
+			if (row >= v_size)
+				throw out_of_bounds();
+			return _row(row, std::index_sequence_for<Fields...>());
+		}
+		const_reference operator[](size_t row) const
+		{
+			if (row >= v_size)
+				throw out_of_bounds();
+			return _row(row, std::index_sequence_for<Fields...>());
+		}
+		reference at(size_t row)
+		{
+			return (*this)[row];
+		}
+		const_reference at(size_t row) const
+		{
+			return (*this)[row];
+		}
+		//one field of one row
+		template<size_t I>
+		field_type<I>& get(size_t row)
+		{
+			return std::get<I>(columns)[row];
+		}
+		template<size_t I>
+		const field_type<I>& get(size_t row) const
+		{
+			return std::get<I>(columns)[row];
+		}
+
+		//the whole column of field I as one contiguous range, valid until the next push_back or reserve
+		template<size_t I>
+		MySpan<field_type<I>> column()
+		{
+			return MySpan<field_type<I>>(std::get<I>(columns).getData(), v_size);
+		}
+		template<size_t I>
+		MySpan<const field_type<I>> column() const
+		{
+			return MySpan<const field_type<I>>(std::get<I>(columns).getData(), v_size);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+		size_t capacity() const
+		{
+			return std::get<0>(columns).capacity();
+		}
+		void reserve(size_t capacity)
+		{
+			_reserve(capacity, std::index_sequence_for<Fields...>());
+		}
+		void clear()
+		{
+			_clear(std::index_sequence_for<Fields...>());
+			v_size = 0;
+		}
+
+		iterator begin()
+		{
+			return iterator(this, 0);
+		}
+		iterator end()
+		{
+			return iterator(this, v_size);
+		}
+
+		//a field that fails to copy takes the fields already appended back out, so the columns stay the same length
+		void push_back(const Fields&... vals)
+		{
+			try
+			{
+				_pushBack(std::index_sequence_for<Fields...>(), vals...);
+			}
+			catch (...)
+			{
+				_dropPartialRow(std::index_sequence_for<Fields...>());
+				throw;
+			}
+			v_size++;
+		}
+		void push_back(const value_type& row)
+		{
+			try
+			{
+				_pushRow(row, std::index_sequence_for<Fields...>());
+			}
+			catch (...)
+			{
+				_dropPartialRow(std::index_sequence_for<Fields...>());
+				throw;
+			}
+			v_size++;
+		}
+		//appends every row of the range, the columns grow once up front when the distance is known
+		template<class Iter>
+		void push_back_rows(Iter firstIt, Iter lastIt)
+		{
+			_reserveFor(firstIt, lastIt, typename std::iterator_traits<Iter>::iterator_category());
+			for (auto it = firstIt; it != lastIt; ++it)
+				push_back(static_cast<const value_type&>(*it));
+		}
+		void pop_back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to pop from an empty vector");
+			_popBack(std::index_sequence_for<Fields...>());
+			v_size--;
+		}
+	private:
+		template<size_t... I>
+		reference _row(size_t row, std::index_sequence<I...>)
+		{
+			return reference(std::get<I>(columns)[row]...);
+		}
+		template<size_t... I>
+		const_reference _row(size_t row, std::index_sequence<I...>) const
+		{
+			return const_reference(std::get<I>(columns)[row]...);
+		}
+		template<size_t... I>
+		void _reserve(size_t capacity, std::index_sequence<I...>)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).reserve(capacity), 0)... };
+		}
+		template<size_t... I>
+		void _clear(std::index_sequence<I...>)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).clear(), 0)... };
+		}
+		template<size_t... I>
+		void _pushBack(std::index_sequence<I...>, const Fields&... vals)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).push_back(vals), 0)... };
+		}
+		template<size_t... I>
+		void _pushRow(const value_type& row, std::index_sequence<I...>)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).push_back(std::get<I>(row)), 0)... };
+		}
+		template<size_t... I>
+		void _popBack(std::index_sequence<I...>)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).pop_back(), 0)... };
+		}
+		//pops the field of every column that got one past v_size
+		template<size_t... I>
+		void _dropPartialRow(std::index_sequence<I...>)
+		{
+			(void)std::initializer_list<int>{ (std::get<I>(columns).size() > v_size ? (std::get<I>(columns).pop_back(), 0) : 0)... };
+		}
+		template<class Iter>
+		void _reserveFor(Iter firstIt, Iter lastIt, std::forward_iterator_tag)
+		{
+			reserve(v_size + std::distance(firstIt, lastIt));
+		}
+		template<class Iter>
+		void _reserveFor(Iter, Iter, std::input_iterator_tag)
+		{}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//non owning view of contiguous elements, it is only valid as long as the memory it points to
+	template<typename T>
+	class MySpan
+	{
+	public:
+		class exception : public std::runtime_error
+		{
+		private:
+		public:
+			exception()
+				:
+				exception("Span exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* msg)
+				:
+				exception(msg)
+			{}
+		};
+	private:
+		T* ptr;
+		size_t count;
+	public:
+		MySpan() noexcept
+			:
+			ptr(nullptr),
+			count(0)
+		{}
+		MySpan(T* ptr, size_t count) noexcept
+			:
+			ptr(ptr),
+			count(count)
+		{}
+		MySpan(MyVector<typename std::remove_const<T>::type>& vec) noexcept
+			:
+			ptr(vec.getData()),
+			count(vec.size())
+		{}
+		template<typename U = T, typename = typename std::enable_if<std::is_const<U>::value>::type>
+		MySpan(const MyVector<typename std::remove_const<T>::type>& vec) noexcept
+			:
+			ptr(vec.getData()),
+			count(vec.size())
+		{}
+		//a span of T converts to a span of const T
+		template<typename U, typename = typename std::enable_if<std::is_same<const U, T>::value>::type>
+		MySpan(const MySpan<U>& other) noexcept
+			:
+			ptr(other.data()),
+			count(other.size())
+		{}
+
+		T& operator[](size_t index) const
+		{
+			if (index >= count)
+				throw out_of_bounds();
+			return ptr[index];
+		}
+		T& front() const
+		{
+			return (*this)[0];
+		}
+		T& back() const
+		{
+			if (count == 0)
+				throw out_of_bounds();
+			return ptr[count - 1];
+		}
+		T* data() const noexcept
+		{
+			return ptr;
+		}
+		size_t size() const noexcept
+		{
+			return count;
+		}
+		bool empty() const noexcept
+		{
+			return count == 0;
+		}
+
+		T* begin() const noexcept
+		{
+			return ptr;
+		}
+		T* end() const noexcept
+		{
+			return ptr + count;
+		}
+
+		//the n elements starting at offset
+		MySpan subspan(size_t offset, size_t n) const
+		{
+			if (offset > count || n > count - offset)
+				throw out_of_bounds("Tried to create subspan out of bounds");
+			return MySpan(ptr + offset, n);
+		}
+		MySpan first(size_t n) const
+		{
+			return subspan(0, n);
+		}
+		MySpan last(size_t n) const
+		{
+			if (n > count)
+				throw out_of_bounds("Tried to create subspan out of bounds");
+			return MySpan(ptr + count - n, n);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <algorithm>
+#include <type_traits>
+
+namespace MySTL
+{
+	//wait-free ring buffer for exactly one producer and one consumer thread.
+	//the capacity is rounded up to a power of two so positions wrap with a mask, head and tail only ever grow
+	template<typename T>
+	class MySpscRing
+	{
+	private:
+		static constexpr size_t cacheLine = 64;
+
+		//never changes after construction, so both sides can share the line
+		alignas(cacheLine) T* buffer;
+		size_t mask;
+		//written by the producer, cachedHead is its last seen head so it only reloads head when the ring looks full
+		alignas(cacheLine) std::atomic<size_t> tail;
+		size_t cachedHead;
+		//written by the consumer, cachedTail is its last seen tail so it only reloads tail when the ring looks empty
+		alignas(cacheLine) std::atomic<size_t> head;
+		size_t cachedTail;
+	public:
+		explicit MySpscRing(size_t capacity)
+			:
+			mask(_roundUp(capacity) - 1),
+			tail(0),
+			cachedHead(0),
+			head(0),
+			cachedTail(0)
+		{
+			//the slots stay uninitialized until an element is pushed into them
+			buffer = static_cast<T*>(::operator new(sizeof(T) * (mask + 1)));
+		}
+		MySpscRing(const MySpscRing&) = delete;
+		MySpscRing& operator=(const MySpscRing&) = delete;
+		~MySpscRing()
+		{
+			for (size_t i = head.load(std::memory_order_relaxed), stop = tail.load(std::memory_order_relaxed); i != stop; i++)
+				buffer[i & mask].~T();
+			::operator delete(buffer);
+		}
+
+		size_t capacity() const
+		{
+			return mask + 1;
+		}
+		//only exact while neither side is running
+		size_t size() const
+		{
+			return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+		}
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		/*////producer side////*/
+
+		bool try_push(const T& val)
+		{
+			return try_emplace(val);
+		}
+		bool try_push(T&& val)
+		{
+			return try_emplace(std::move(val));
+		}
+		template<typename... args>
+		bool try_emplace(args&&... vals)
+		{
+			size_t pos = tail.load(std::memory_order_relaxed);
+			if (pos - cachedHead > mask)
+			{
+				cachedHead = head.load(std::memory_order_acquire);
+				if (pos - cachedHead > mask)
+					return false;
+			}
+			new (&buffer[pos & mask]) T(std::forward<args>(vals)...);
+			tail.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		//copies up to count elements from first in a single pass and publishes them at once,
+		//returns how many fit
+		template<class Iter>
+		size_t push_n(Iter first, size_t count)
+		{
+			size_t pos = tail.load(std::memory_order_relaxed);
+			size_t space = capacity() - (pos - cachedHead);
+			if (space < count)
+			{
+				cachedHead = head.load(std::memory_order_acquire);
+				space = capacity() - (pos - cachedHead);
+			}
+			if (count > space)
+				count = space;
+
+			//first is advanced once per element and never past the last one, so input iterators work too
+			size_t done = 0;
+			try
+			{
+				while (done < count)
+				{
+					new (&buffer[(pos + done) & mask]) T(*first);
+					if (++done < count)
+						++first;
+				}
+			}
+			catch (...)
+			{
+				for (size_t i = 0; i < done; i++)
+					buffer[(pos + i) & mask].~T();
+				throw;
+			}
+			tail.store(pos + count, std::memory_order_release);
+			return count;
+		}
+
+		/*////consumer side////*/
+
+		bool try_pop(T& val)
+		{
+			size_t pos = head.load(std::memory_order_relaxed);
+			if (pos == cachedTail)
+			{
+				cachedTail = tail.load(std::memory_order_acquire);
+				if (pos == cachedTail)
+					return false;
+			}
+			T& slot = buffer[pos & mask];
+			val = std::move(slot);
+			slot.~T();
+			head.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+		//moves up to count elements to out as at most two contiguous blocks and frees their slots at once,
+		//returns how many were taken
+		template<class OutIter>
+		size_t pop_n(OutIter out, size_t count)
+		{
+			size_t pos = head.load(std::memory_order_relaxed);
+			size_t available = cachedTail - pos;
+			if (available < count)
+			{
+				cachedTail = tail.load(std::memory_order_acquire);
+				available = cachedTail - pos;
+			}
+			if (count > available)
+				count = available;
+
+			size_t start = pos & mask;
+			size_t firstPart = capacity() - start < count ? capacity() - start : count;
+			out = std::move(buffer + start, buffer + start + firstPart, out);
+			std::move(buffer, buffer + (count - firstPart), out);
+			if (!std::is_trivially_destructible<T>::value)
+			{
+				for (size_t i = 0; i < firstPart; i++)
+					buffer[start + i].~T();
+				for (size_t i = 0; i < count - firstPart; i++)
+					buffer[i].~T();
+			}
+			head.store(pos + count, std::memory_order_release);
+			return count;
+		}
+	private:
+		static size_t _roundUp(size_t capacity)
+		{
+			size_t result = 1;
+			while (result < capacity)
+				result <<= 1;
+			return result;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,525 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <new>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//storage policy of MyStaticVector. default constructible, trivially destructible elements live in a plain array,
+	//which keeps the vector a literal type that can be filled in constant expressions
+	template<typename T, size_t N, bool Literal = std::is_trivially_destructible<T>::value && std::is_default_constructible<T>::value>
+	class MyStaticVectorStorage
+	{
+	protected:
+		T elements[N == 0 ? 1 : N] = {};
+		size_t v_size = 0;
+
+		constexpr T* _data()
+		{
+			return elements;
+		}
+		constexpr const T* _data() const
+		{
+			return elements;
+		}
+		template<typename... args>
+		constexpr void _construct(size_t index, args&&... vals)
+		{
+			elements[index] = T(std::forward<args>(vals)...);
+		}
+		constexpr void _destroy(size_t)
+		{}
+	};
+	//every other type is constructed in raw bytes when it is added and destroyed when it is removed
+	template<typename T, size_t N>
+	class MyStaticVectorStorage<T, N, false>
+	{
+	protected:
+		alignas(T) unsigned char bytes[sizeof(T) * (N == 0 ? 1 : N)];
+		size_t v_size = 0;
+
+		MyStaticVectorStorage()
+		{}
+		MyStaticVectorStorage(const MyStaticVectorStorage&)
+		{}
+		MyStaticVectorStorage& operator=(const MyStaticVectorStorage&)
+		{
+			return *this;
+		}
+		~MyStaticVectorStorage()
+		{
+			for (size_t i = 0; i < v_size; i++)
+				_destroy(i);
+		}
+
+		T* _data()
+		{
+			return std::launder(reinterpret_cast<T*>(bytes));
+		}
+		const T* _data() const
+		{
+			return std::launder(reinterpret_cast<const T*>(bytes));
+		}
+		template<typename... args>
+		void _construct(size_t index, args&&... vals)
+		{
+			new (reinterpret_cast<T*>(bytes) + index) T(std::forward<args>(vals)...);
+		}
+		void _destroy(size_t index)
+		{
+			_data()[index].~T();
+		}
+	};
+
+	//MyVector with room for N elements inside the object instead of on the heap. adding past N throws
+	//MyVector<T>::out_of_bounds, iterators are plain pointers
+	template<typename T, size_t N>
+	class MyStaticVector : private MyStaticVectorStorage<T, N>
+	{
+	private:
+		using Storage = MyStaticVectorStorage<T, N>;
+		using Storage::v_size;
+		using Storage::_data;
+		using Storage::_construct;
+		using Storage::_destroy;
+	public:
+		using exception = typename MyVector<T>::exception;
+		using out_of_bounds = typename MyVector<T>::out_of_bounds;
+		using bad_iterator = typename MyVector<T>::bad_iterator;
+
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+	public:
+		constexpr MyStaticVector()
+		{}
+		constexpr MyStaticVector(size_t n, const T& val = T())
+		{
+			_requireRoom(n);
+			for (size_t i = 0; i < n; i++)
+				emplace_back(val);
+		}
+		template<class Iter, typename = typename std::enable_if<!std::is_integral<Iter>::value>::type>
+		constexpr MyStaticVector(Iter firstIt, Iter lastIt)
+		{
+			for (auto it = firstIt; it != lastIt; ++it)
+				emplace_back(*it);
+		}
+		constexpr MyStaticVector(std::initializer_list<T> list)
+			:
+			MyStaticVector(list.begin(), list.end())
+		{}
+		constexpr MyStaticVector(const MyStaticVector& copy)
+			:
+			Storage()
+		{
+			for (size_t i = 0; i < copy.v_size; i++)
+				emplace_back(copy._data()[i]);
+		}
+		constexpr MyStaticVector(MyStaticVector&& donor)
+			:
+			Storage()
+		{
+			for (size_t i = 0; i < donor.v_size; i++)
+				emplace_back(std::move(donor._data()[i]));
+		}
+
+		constexpr MyStaticVector& operator=(const MyStaticVector& copy)
+		{
+			if (&copy != this)
+			{
+				clear();
+				for (size_t i = 0; i < copy.v_size; i++)
+					emplace_back(copy._data()[i]);
+			}
+			return *this;
+		}
+		constexpr MyStaticVector& operator=(MyStaticVector&& donor)
+		{
+			if (&donor != this)
+			{
+				clear();
+				for (size_t i = 0; i < donor.v_size; i++)
+					emplace_back(std::move(donor._data()[i]));
+			}
+			return *this;
+		}
+		constexpr MyStaticVector& operator=(std::initializer_list<T> list)
+		{
+			clear();
+			_requireRoom(list.size());
+			for (auto it = list.begin(); it != list.end(); ++it)
+				emplace_back(*it);
+			return *this;
+		}
+
+		constexpr T& operator[](size_t index)
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return _data()[index];
+		}
+		constexpr const T& operator[](size_t index) const
+		{
+			if (index >= v_size)
+				throw out_of_bounds();
+			return _data()[index];
+		}
+		constexpr T& at(size_t n)
+		{
+			return (*this)[n];
+		}
+		constexpr const T& at(size_t n) const
+		{
+			return (*this)[n];
+		}
+		constexpr T& front()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return _data()[0];
+		}
+		constexpr const T& front() const
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return _data()[0];
+		}
+		constexpr T& back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return _data()[v_size - 1];
+		}
+		constexpr const T& back() const
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to access element in empty vector");
+			return _data()[v_size - 1];
+		}
+
+		constexpr size_t size() const
+		{
+			return v_size;
+		}
+		constexpr size_t maxSize() const
+		{
+			return N;
+		}
+		constexpr size_t capacity() const
+		{
+			return N;
+		}
+		constexpr bool empty() const
+		{
+			return v_size == 0;
+		}
+		constexpr T* getData()
+		{
+			return _data();
+		}
+		constexpr const T* getData() const
+		{
+			return _data();
+		}
+
+		constexpr iterator begin()
+		{
+			return _data();
+		}
+		constexpr const_iterator begin() const
+		{
+			return _data();
+		}
+		constexpr const_iterator cbegin() const
+		{
+			return _data();
+		}
+		constexpr iterator end()
+		{
+			return _data() + v_size;
+		}
+		constexpr const_iterator end() const
+		{
+			return _data() + v_size;
+		}
+		constexpr const_iterator cend() const
+		{
+			return _data() + v_size;
+		}
+
+		constexpr void resize(size_t n, const T& val = T())
+		{
+			_requireRoom(n > v_size ? n - v_size : 0);
+			while (v_size > n)
+				pop_back();
+			while (v_size < n)
+				emplace_back(val);
+		}
+		constexpr void clear()
+		{
+			while (v_size > 0)
+				_destroy(--v_size);
+		}
+		constexpr void swap(MyStaticVector& other)
+		{
+			MyStaticVector temp(std::move(other));
+			other = std::move(*this);
+			*this = std::move(temp);
+		}
+
+		template<typename... args>
+		constexpr T& emplace_back(args&&... vals)
+		{
+			_requireRoom(1);
+			_construct(v_size, std::forward<args>(vals)...);
+			return _data()[v_size++];
+		}
+		constexpr void push_back(const T& val)
+		{
+			emplace_back(val);
+		}
+		constexpr void push_back(T&& val)
+		{
+			emplace_back(std::move(val));
+		}
+		template<typename... args>
+		constexpr iterator emplace(const_iterator position, args&&... vals)
+		{
+			size_t index = _index(position);
+			_requireRoom(1);
+			if (index == v_size)
+			{
+				emplace_back(std::forward<args>(vals)...);
+				return begin() + index;
+			}
+			//vals may refer to an element that is about to move
+			T val(std::forward<args>(vals)...);
+			T* data = _data();
+			_construct(v_size, std::move(data[v_size - 1]));
+			v_size++;
+			for (size_t i = v_size - 2; i > index; i--)
+				data[i] = std::move(data[i - 1]);
+			data[index] = std::move(val);
+			return begin() + index;
+		}
+		constexpr iterator insert(const_iterator position, const T& val)
+		{
+			return emplace(position, val);
+		}
+		constexpr iterator insert(const_iterator position, T&& val)
+		{
+			return emplace(position, std::move(val));
+		}
+		constexpr iterator insert(const_iterator position, size_t n, const T& val)
+		{
+			size_t index = _index(position);
+			_requireRoom(n);
+			T copy(val);
+			for (size_t i = 0; i < n; i++)
+				emplace_back(copy);
+			_rotate(index, v_size - n);
+			return begin() + index;
+		}
+		constexpr iterator insert(const_iterator position, std::initializer_list<T> list)
+		{
+			return insert(position, list.begin(), list.end());
+		}
+		//appends the range and rotates it into place, so every element moves at most twice.
+		//if the range does not fit or an element throws, the vector is left as it was
+		template<class Iter, typename = typename std::enable_if<!std::is_integral<Iter>::value>::type>
+		constexpr iterator insert(const_iterator position, Iter firstIt, Iter lastIt)
+		{
+			size_t index = _index(position);
+			size_t oldSize = v_size;
+			using checkedUpFront = std::integral_constant<bool, std::is_nothrow_constructible<T, decltype(*firstIt)>::value
+				&& std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iter>::iterator_category>::value>;
+			_appendRange(firstIt, lastIt, checkedUpFront());
+			_rotate(index, oldSize);
+			return begin() + index;
+		}
+
+		constexpr iterator erase(const_iterator position)
+		{
+			size_t index = _index(position);
+			if (index == v_size)
+				throw out_of_bounds("Tried to erase element out of bounds");
+			return erase(position, position + 1);
+		}
+		constexpr iterator erase(const_iterator firstIt, const_iterator lastIt)
+		{
+			size_t first = _index(firstIt);
+			size_t last = _index(lastIt);
+			if (first > last)
+				throw bad_iterator("Tried to erase a range that ends before it starts");
+			//an empty range would move every later element onto itself
+			if (first == last)
+				return begin() + first;
+			T* data = _data();
+			for (size_t i = last; i < v_size; i++)
+				data[i - (last - first)] = std::move(data[i]);
+			for (size_t i = last - first; i > 0; i--)
+				_destroy(--v_size);
+			return begin() + first;
+		}
+		constexpr void pop_back()
+		{
+			if (v_size == 0)
+				throw out_of_bounds("Tried to erase element out of bounds");
+			_destroy(--v_size);
+		}
+		constexpr void pop_front()
+		{
+			erase(begin());
+		}
+
+		/*//////////////////////////////////////////*/
+		/*////Extra Methods (not in std::vector)////*/
+		/*//////////////////////////////////////////*/
+
+		//execute the lambda taking each element as parameter
+		template<typename Func>
+		constexpr void forEach(Func lambda)
+		{
+			for (size_t i = 0; i < v_size; i++)
+				lambda(_data()[i]);
+		}
+
+		//heap sort, needs no extra memory and runs in constant expressions
+		template<typename Comp>
+		constexpr void sort(Comp comp)
+		{
+			T* data = _data();
+			for (size_t i = v_size / 2; i > 0; i--)
+				_siftDown(data, i - 1, v_size, comp);
+			for (size_t end = v_size; end > 1; end--)
+			{
+				_swap(data[0], data[end - 1]);
+				_siftDown(data, 0, end - 1, comp);
+			}
+		}
+		constexpr void sort()
+		{
+			sort([](const T& a, const T& b) { return a < b; });
+		}
+		constexpr void rsort()
+		{
+			sort([](const T& a, const T& b) { return b < a; });
+		}
+
+		//check if the vector contains the element by using the == operator
+		constexpr bool contains(const T& val) const
+		{
+			for (size_t i = 0; i < v_size; i++)
+			{
+				if (_data()[i] == val)
+					return true;
+			}
+			return false;
+		}
+		//return how often the vector contains an item using the == operator
+		constexpr size_t count(const T& val) const
+		{
+			size_t ret = 0;
+			for (size_t i = 0; i < v_size; i++)
+			{
+				if (_data()[i] == val)
+					ret++;
+			}
+			return ret;
+		}
+		//split the vector at the first occurence of the element (none of the returned values contains val)
+		constexpr std::pair<MyStaticVector, MyStaticVector> split(const T& val) const
+		{
+			size_t i = 0;
+			while (i < v_size && !(_data()[i] == val))
+				i++;
+			std::pair<MyStaticVector, MyStaticVector> parts;
+			for (size_t j = 0; j < i; j++)
+				parts.first.emplace_back(_data()[j]);
+			for (size_t j = i + 1; j < v_size; j++)
+				parts.second.emplace_back(_data()[j]);
+			return parts;
+		}
+		//reverses the element order
+		constexpr void reverse()
+		{
+			_reverse(0, v_size);
+		}
+	private:
+		constexpr void _requireRoom(size_t n) const
+		{
+			if (n > N - v_size)
+				throw out_of_bounds("Tried to add more elements than the static vector can hold");
+		}
+		//the distance is known and constructing cannot throw, so nothing fails once the room is checked
+		template<class Iter>
+		constexpr void _appendRange(Iter firstIt, Iter lastIt, std::true_type)
+		{
+			_requireRoom(static_cast<size_t>(std::distance(firstIt, lastIt)));
+			for (auto it = firstIt; it != lastIt; ++it)
+				emplace_back(*it);
+		}
+		//destroys what was appended before an exception, not usable in constant expressions because of the try
+		template<class Iter>
+		void _appendRange(Iter firstIt, Iter lastIt, std::false_type)
+		{
+			size_t oldSize = v_size;
+			try
+			{
+				for (auto it = firstIt; it != lastIt; ++it)
+					emplace_back(*it);
+			}
+			catch (...)
+			{
+				while (v_size > oldSize)
+					_destroy(--v_size);
+				throw;
+			}
+		}
+		constexpr size_t _index(const_iterator position) const
+		{
+			if (position < _data() || position > _data() + v_size)
+				throw bad_iterator("Tried to pass iterator from different vector");
+			return size_t(position - _data());
+		}
+		//moves [middle, v_size) in front of [first, middle)
+		constexpr void _rotate(size_t first, size_t middle)
+		{
+			_reverse(first, middle);
+			_reverse(middle, v_size);
+			_reverse(first, v_size);
+		}
+		constexpr void _reverse(size_t first, size_t last)
+		{
+			T* data = _data();
+			while (first + 1 < last)
+				_swap(data[first++], data[--last]);
+		}
+		static constexpr void _swap(T& a, T& b)
+		{
+			T temp(std::move(a));
+			a = std::move(b);
+			b = std::move(temp);
+		}
+		template<typename Comp>
+		static constexpr void _siftDown(T* data, size_t root, size_t count, Comp& comp)
+		{
+			while (2 * root + 1 < count)
+			{
+				size_t child = 2 * root + 1;
+				if (child + 1 < count && comp(data[child], data[child + 1]))
+					child++;
+				if (!comp(data[root], data[child]))
+					return;
+				_swap(data[root], data[child]);
+				root = child;
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include "MyVector.h"
+
+namespace MySTL
+{
+	//fixed set of worker threads for data parallel loops. every loop splits its index range evenly between the participants,
+	//a participant that runs out steals the back half of another one's rest. chunks start at the minimum grain and
+	//grow or shrink per participant until one chunk takes about 50 microseconds
+	class MyThreadPool
+	{
+	private:
+		//the rest of the index range a participant still owns, it takes from the front and thieves from the back
+		struct alignas(64) Range
+		{
+			std::mutex lock;
+			size_t begin = 0;
+			size_t end = 0;
+		};
+		//one running loop, lives on the stack of the calling thread until every worker left it
+		struct Job
+		{
+			void (*run)(void*, size_t, size_t, size_t);
+			void* body;
+			size_t minGrain;
+			size_t maxGrain; //a participant's share of the loop, larger chunks could only hurt balancing
+			std::atomic<size_t> active;
+			std::atomic<bool> failed;
+			std::exception_ptr error;
+			std::mutex errorLock;
+		};
+
+		MyVector<std::thread> workers;
+		std::unique_ptr<Range[]> ranges; //one per participant, the calling thread is participant 0
+		size_t participants;
+
+		std::mutex jobLock; //loops of different callers run one after another
+		std::mutex wakeLock;
+		std::condition_variable wake;
+		std::condition_variable done;
+		Job* job = nullptr;
+		size_t generation = 0;
+		bool stopping = false;
+	public:
+		explicit MyThreadPool(size_t threads = std::thread::hardware_concurrency())
+			:
+			ranges(new Range[threads == 0 ? 1 : threads]),
+			participants(threads == 0 ? 1 : threads)
+		{
+			workers.reserve(participants - 1);
+			for (size_t i = 1; i < participants; i++)
+				workers.push_back(std::thread([this, i] { _workerLoop(i); }));
+		}
+		MyThreadPool(const MyThreadPool&) = delete;
+		MyThreadPool& operator=(const MyThreadPool&) = delete;
+		~MyThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(wakeLock);
+				stopping = true;
+			}
+			wake.notify_all();
+			for (size_t i = 0; i < workers.size(); i++)
+				workers[i].join();
+		}
+
+		//the pool the parallel algorithms run on when none is given, one participant per hardware thread
+		static MyThreadPool& shared()
+		{
+			static MyThreadPool pool;
+			return pool;
+		}
+		size_t concurrency() const
+		{
+			return participants;
+		}
+
+		//calls body(first, last, participant) for disjoint chunks covering [0, count) and returns once all are done.
+		//participant is below concurrency() and never runs two chunks at once, the first exception of body is rethrown.
+		//loops started from inside a body and ranges of at most minGrain elements run on the calling thread
+		template<class Body>
+		void parallel_for(size_t count, size_t minGrain, Body body)
+		{
+			if (minGrain == 0)
+				minGrain = 1;
+			if (count == 0)
+				return;
+			if (count <= minGrain || participants == 1 || _insideJob())
+			{
+				body(size_t(0), count, size_t(0));
+				return;
+			}
+
+			std::lock_guard<std::mutex> serial(jobLock);
+			Job current;
+			current.run = [](void* body, size_t first, size_t last, size_t participant) {
+				(*static_cast<Body*>(body))(first, last, participant);
+			};
+			current.body = &body;
+			current.minGrain = minGrain;
+			current.maxGrain = count / participants > minGrain ? count / participants : minGrain;
+			current.active.store(participants - 1, std::memory_order_relaxed);
+			current.failed.store(false, std::memory_order_relaxed);
+			for (size_t i = 0; i < participants; i++)
+			{
+				ranges[i].begin = count / participants * i + (i < count % participants ? i : count % participants);
+				ranges[i].end = ranges[i].begin + count / participants + (i < count % participants ? 1 : 0);
+			}
+			{
+				std::lock_guard<std::mutex> lock(wakeLock);
+				job = &current;
+				generation++;
+			}
+			wake.notify_all();
+
+			_insideJob() = true;
+			_participate(current, 0);
+			_insideJob() = false;
+
+			{
+				std::unique_lock<std::mutex> lock(wakeLock);
+				done.wait(lock, [&] { return current.active.load(std::memory_order_acquire) == 0; });
+				job = nullptr;
+			}
+			if (current.error)
+				std::rethrow_exception(current.error);
+		}
+	private:
+		static bool& _insideJob()
+		{
+			thread_local bool inside = false;
+			return inside;
+		}
+		void _workerLoop(size_t participant)
+		{
+			_insideJob() = true;
+			size_t seen = 0;
+			while (true)
+			{
+				Job* current;
+				{
+					std::unique_lock<std::mutex> lock(wakeLock);
+					wake.wait(lock, [&] { return stopping || generation != seen; });
+					if (stopping)
+						return;
+					seen = generation;
+					current = job;
+				}
+				_participate(*current, participant);
+				if (current->active.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					std::lock_guard<std::mutex> lock(wakeLock);
+					done.notify_all();
+				}
+			}
+		}
+		void _participate(Job& current, size_t participant)
+		{
+			//long enough to make the clock reads and range locking negligible, short enough for balancing
+			const auto targetChunkTime = std::chrono::microseconds(50);
+			size_t grain = current.minGrain;
+			size_t first, last;
+			while (!current.failed.load(std::memory_order_relaxed) && _take(participant, grain, first, last))
+			{
+				auto start = std::chrono::steady_clock::now();
+				try
+				{
+					current.run(current.body, first, last, participant);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(current.errorLock);
+					if (!current.error)
+						current.error = std::current_exception();
+					current.failed.store(true, std::memory_order_relaxed);
+				}
+				auto elapsed = std::chrono::steady_clock::now() - start;
+				if (elapsed < targetChunkTime / 2 && grain <= current.maxGrain / 2)
+					grain *= 2;
+				else if (elapsed > targetChunkTime * 4 && grain / 2 >= current.minGrain)
+					grain /= 2;
+			}
+		}
+		//next chunk from our own range, steals the back half of another range once ours is empty
+		bool _take(size_t participant, size_t grain, size_t& first, size_t& last)
+		{
+			Range& own = ranges[participant];
+			while (true)
+			{
+				{
+					std::lock_guard<std::mutex> lock(own.lock);
+					if (own.begin < own.end)
+					{
+						first = own.begin;
+						last = own.end - own.begin > grain ? own.begin + grain : own.end;
+						own.begin = last;
+						return true;
+					}
+				}
+				if (!_steal(participant))
+					return false;
+			}
+		}
+		bool _steal(size_t participant)
+		{
+			for (size_t i = 1; i < participants; i++)
+			{
+				Range& victim = ranges[(participant + i) % participants];
+				size_t stolenBegin, stolenEnd;
+				{
+					std::lock_guard<std::mutex> lock(victim.lock);
+					size_t rest = victim.end - victim.begin;
+					if (rest < 2)
+						continue;
+					stolenBegin = victim.begin + rest / 2;
+					stolenEnd = victim.end;
+					victim.end = stolenBegin;
+				}
+				Range& own = ranges[participant];
+				std::lock_guard<std::mutex> lock(own.lock);
+				own.begin = stolenBegin;
+				own.end = stolenEnd;
+				return true;
+			}
+			return false;
+		}
+	};
+}
\ No newline at end of file
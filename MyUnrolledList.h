@@ -0,0 +1,913 @@
+#pragma once
+
+#include <stdexcept>
+#include <initializer_list>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace MySTL
+{
+	//a doubly linked list that stores up to BlockSize elements per node, so a scan only misses the cache once per block
+	template<typename T, size_t BlockSize = 16>
+	class MyUnrolledList
+	{
+		static_assert(BlockSize >= 2, "A block has to be able to hold at least two elements");
+	public:
+		class exception : public std::runtime_error
+		{
+		public:
+			exception()
+				:
+				exception("UnrolledList exception")
+			{}
+			exception(const char* message)
+				:
+				std::runtime_error(message)
+			{}
+		};
+		class out_of_bounds : public exception
+		{
+		public:
+			out_of_bounds()
+				:
+				exception("Tried to access element out of bounds")
+			{}
+			out_of_bounds(const char* message)
+				:
+				exception(message)
+			{}
+		};
+		class bad_iterator : public exception
+		{
+		public:
+			bad_iterator()
+				:
+				exception("Bad iterator")
+			{}
+			bad_iterator(const char* message)
+				:
+				exception(message)
+			{}
+		};
+	private:
+		struct BlockBase
+		{
+			BlockBase* prev;
+			BlockBase* next;
+		};
+		//a block is never empty while it is linked, only the first count slots hold constructed elements
+		struct Block : public BlockBase
+		{
+			size_t count;
+			alignas(T) unsigned char storage[sizeof(T) * BlockSize];
+			Block(BlockBase* prev, BlockBase* next)
+				:
+				BlockBase{ prev, next },
+				count(0)
+			{}
+			T* items()
+			{
+				return reinterpret_cast<T*>(storage);
+			}
+		};
+	public:
+		class iterator
+		{
+		public:
+			using value_type = T;
+			using reference = T&;
+			using pointer = T*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::bidirectional_iterator_tag;
+		public:
+			class bad_iterator_compare : public exception
+			{
+			public:
+				bad_iterator_compare()
+					:
+					exception("Tried to compare false iterators")
+				{}
+				bad_iterator_compare(const char* message)
+					:
+					exception(message)
+				{}
+			};
+		private:
+			friend class MyUnrolledList;
+
+			MyUnrolledList* list;
+			BlockBase* block;
+			size_t index;
+		protected:
+			iterator(MyUnrolledList* list, BlockBase* block, size_t index)
+				:
+				list(list),
+				block(block),
+				index(index)
+			{}
+		public:
+			reference operator*() const
+			{
+				if (block == &list->head || block == &list->tail)
+					throw out_of_bounds("Tried to dereference invalid element");
+				return _block(block)->items()[index];
+			}
+			pointer operator->() const
+			{
+				if (block == &list->head || block == &list->tail)
+					throw out_of_bounds("Tried to access invalid element");
+				return &_block(block)->items()[index];
+			}
+
+			iterator& operator++()
+			{
+				if (block == &list->tail)
+					throw out_of_bounds("Tried to increment iterator out of bounds");
+				if (++index == _block(block)->count)
+				{
+					block = block->next;
+					index = 0;
+				}
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator result(*this);
+				++(*this);
+				return result;
+			}
+			iterator& operator--()
+			{
+				if (index > 0)
+				{
+					index--;
+					return *this;
+				}
+				if (block->prev == &list->head)
+					throw out_of_bounds("Tried to decrement iterator out of bounds");
+				block = block->prev;
+				index = _block(block)->count - 1;
+				return *this;
+			}
+			iterator operator--(int)
+			{
+				iterator result(*this);
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const iterator& other) const
+			{
+				if (list == other.list)
+					return block == other.block && index == other.index;
+				else
+					throw bad_iterator_compare("Tried to compare iterators from different lists");
+			}
+			bool operator!=(const iterator& other) const
+			{
+				return !(*this == other);
+			}
+		};
+		class const_iterator : public iterator
+		{
+		private:
+			friend class MyUnrolledList;
+		protected:
+			const_iterator(const MyUnrolledList* list, BlockBase* block, size_t index)
+				:
+				iterator(const_cast<MyUnrolledList*>(list), block, index)
+			{}
+		public:
+			const T& operator*() const
+			{
+				return iterator::operator*();
+			}
+			const T* operator->() const
+			{
+				return iterator::operator->();
+			}
+		};
+		class reverse_iterator : public iterator
+		{
+		private:
+			friend class MyUnrolledList;
+		protected:
+			reverse_iterator(MyUnrolledList* list, BlockBase* block, size_t index)
+				:
+				iterator(list, block, index)
+			{}
+		public:
+			reverse_iterator& operator++()
+			{
+				if (iterator::block == &iterator::list->head)
+					throw out_of_bounds("Tried to increment reverse iterator past the reverse end");
+				if (iterator::index > 0)
+					iterator::index--;
+				else
+				{
+					iterator::block = iterator::block->prev;
+					iterator::index = iterator::block == &iterator::list->head ? 0 : _block(iterator::block)->count - 1;
+				}
+				return *this;
+			}
+			reverse_iterator operator++(int)
+			{
+				reverse_iterator result(*this);
+				++(*this);
+				return result;
+			}
+			reverse_iterator& operator--()
+			{
+				if (iterator::block == &iterator::list->head)
+				{
+					if (iterator::list->empty())
+						throw out_of_bounds("Tried to decrement reverse iterator past the reverse begin");
+					iterator::block = iterator::list->head.next;
+					iterator::index = 0;
+				}
+				else if (iterator::index + 1 < _block(iterator::block)->count)
+					iterator::index++;
+				else if (iterator::block->next == &iterator::list->tail)
+					throw out_of_bounds("Tried to decrement reverse iterator past the reverse begin");
+				else
+				{
+					iterator::block = iterator::block->next;
+					iterator::index = 0;
+				}
+				return *this;
+			}
+			reverse_iterator operator--(int)
+			{
+				reverse_iterator result(*this);
+				--(*this);
+				return result;
+			}
+		};
+		class const_reverse_iterator : public reverse_iterator
+		{
+		private:
+			friend class MyUnrolledList;
+		protected:
+			const_reverse_iterator(const MyUnrolledList* list, BlockBase* block, size_t index)
+				:
+				reverse_iterator(const_cast<MyUnrolledList*>(list), block, index)
+			{}
+		public:
+			const T& operator*() const
+			{
+				return reverse_iterator::operator*();
+			}
+			const T* operator->() const
+			{
+				return reverse_iterator::operator->();
+			}
+		};
+	private:
+		friend class iterator;
+
+		BlockBase head; //one block before the first
+		BlockBase tail; //one block after the last
+		size_t v_size;
+	public:
+		MyUnrolledList() noexcept
+			:
+			head{ nullptr, &tail },
+			tail{ &head, nullptr },
+			v_size(0)
+		{}
+		MyUnrolledList(const MyUnrolledList& copy)
+			:
+			MyUnrolledList()
+		{
+			for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
+				push_back(*it);
+		}
+		MyUnrolledList(MyUnrolledList&& donor) noexcept
+			:
+			MyUnrolledList()
+		{
+			_takeBlocks(donor);
+		}
+		~MyUnrolledList()
+		{
+			clear();
+		}
+
+		template<class Iter>
+		MyUnrolledList(Iter firstIt, Iter lastIt)
+			:
+			MyUnrolledList()
+		{
+			for (auto it = firstIt; it != lastIt; ++it)
+				push_back(*it);
+		}
+		MyUnrolledList(size_t size, const T& val = T())
+			:
+			MyUnrolledList()
+		{
+			for (size_t i = 0; i < size; i++)
+				push_back(val);
+		}
+		MyUnrolledList(std::initializer_list<T> list)
+			:
+			MyUnrolledList(list.begin(), list.end())
+		{}
+
+		MyUnrolledList& operator=(const MyUnrolledList& copy)
+		{
+			if (this != &copy)
+			{
+				clear();
+				for (auto it = copy.cbegin(), stop = copy.cend(); it != stop; ++it)
+					push_back(*it);
+			}
+			return *this;
+		}
+		MyUnrolledList& operator=(MyUnrolledList&& donor) noexcept
+		{
+			if (this != &donor)
+			{
+				clear();
+				_takeBlocks(donor);
+			}
+			return *this;
+		}
+		MyUnrolledList& operator=(std::initializer_list<T> list)
+		{
+			clear();
+			for (auto it = list.begin(), stop = list.end(); it != stop; ++it)
+				push_back(*it);
+			return *this;
+		}
+
+		void swap(MyUnrolledList& list) noexcept
+		{
+			MyUnrolledList temp(std::move(list));
+			list._takeBlocks(*this);
+			_takeBlocks(temp);
+		}
+
+		size_t size() const
+		{
+			return v_size;
+		}
+		size_t max_size() const
+		{
+			return size_t(-1);
+		}
+		bool empty() const
+		{
+			return v_size == 0;
+		}
+
+		void clear()
+		{
+			BlockBase* block = head.next;
+			while (block != &tail)
+			{
+				BlockBase* next = block->next;
+				_destroyItems(_block(block), 0);
+				delete _block(block);
+				block = next;
+			}
+			head.next = &tail;
+			tail.prev = &head;
+			v_size = 0;
+		}
+
+		T& front()
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _block(head.next)->items()[0];
+		}
+		const T& front() const
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _block(head.next)->items()[0];
+		}
+		T& back()
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _block(tail.prev)->items()[_block(tail.prev)->count - 1];
+		}
+		const T& back() const
+		{
+			if (empty())
+				throw exception("Cannot access element in empty list");
+			return _block(tail.prev)->items()[_block(tail.prev)->count - 1];
+		}
+
+		iterator begin()
+		{
+			return iterator(this, head.next, 0);
+		}
+		const_iterator cbegin() const
+		{
+			return const_iterator(this, head.next, 0);
+		}
+		reverse_iterator rbegin()
+		{
+			if (empty())
+				return rend();
+			return reverse_iterator(this, tail.prev, _block(tail.prev)->count - 1);
+		}
+		const_reverse_iterator crbegin() const
+		{
+			if (empty())
+				return crend();
+			return const_reverse_iterator(this, tail.prev, _block(tail.prev)->count - 1);
+		}
+		iterator end()
+		{
+			return iterator(this, &tail, 0);
+		}
+		const_iterator cend() const
+		{
+			return const_iterator(this, const_cast<BlockBase*>(&tail), 0);
+		}
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this, &head, 0);
+		}
+		const_reverse_iterator crend() const
+		{
+			return const_reverse_iterator(this, const_cast<BlockBase*>(&head), 0);
+		}
+
+		iterator insert(iterator position, const T& val)
+		{
+			T copy = val;
+			return insert(position, std::move(copy));
+		}
+		//fills the previous block before splitting a full one, a split moves the upper half into a new block
+		iterator insert(iterator position, T&& val)
+		{
+			_validateIterator(position);
+			if (position.block == &head)
+				throw out_of_bounds("Tried to insert before the beginning");
+			Block* block = nullptr;
+			size_t index = position.index;
+			if (position.block == &tail || (index == 0 && position.block->prev != &head))
+			{
+				if (position.block->prev != &head && _block(position.block->prev)->count < BlockSize)
+				{
+					block = _block(position.block->prev);
+					index = block->count;
+				}
+				else if (position.block == &tail)
+				{
+					block = _newBlock(tail.prev);
+					index = 0;
+				}
+			}
+			if (block == nullptr)
+			{
+				block = _block(position.block);
+				if (block->count == BlockSize)
+				{
+					Block* upper = _splitBlock(block, BlockSize / 2);
+					if (index > BlockSize / 2)
+					{
+						block = upper;
+						index -= BlockSize / 2;
+					}
+				}
+			}
+			_insertItem(block, index, std::move(val));
+			v_size++;
+			return iterator(this, block, index);
+		}
+		iterator insert(iterator position, size_t count, const T& val)
+		{
+			_validateIterator(position);
+			if (count == 0)
+				return position;
+			iterator it = insert(position, val);
+			for (size_t i = 1; i < count; i++)
+				it = insert(++it, val);
+			//a later insert may have split the block of the first one, so walk back to it
+			for (size_t i = 1; i < count; i++)
+				--it;
+			return it;
+		}
+		iterator insert(iterator position, std::initializer_list<T> list)
+		{
+			return insert(position, list.begin(), list.end());
+		}
+		template<class Iter>
+		iterator insert(iterator position, Iter firstIt, Iter lastIt)
+		{
+			_validateIterator(position);
+			if (firstIt == lastIt)
+				return position;
+			iterator it = insert(position, *firstIt);
+			size_t count = 1;
+			for (auto in = ++firstIt; in != lastIt; ++in, count++)
+				it = insert(++it, *in);
+			//a later insert may have split the block of the first one, so walk back to it
+			for (size_t i = 1; i < count; i++)
+				--it;
+			return it;
+		}
+
+		template<typename... args>
+		iterator emplace(iterator position, args&&... vals)
+		{
+			return insert(position, T(std::forward<args>(vals)...));
+		}
+		template<typename... args>
+		void emplace_back(args&&... vals)
+		{
+			insert(end(), T(std::forward<args>(vals)...));
+		}
+		template<typename... args>
+		void emplace_front(args&&... vals)
+		{
+			insert(begin(), T(std::forward<args>(vals)...));
+		}
+
+		void push_back(const T& val)
+		{
+			insert(end(), val);
+		}
+		void push_back(T&& val)
+		{
+			insert(end(), std::move(val));
+		}
+		void push_front(const T& val)
+		{
+			insert(begin(), val);
+		}
+		void push_front(T&& val)
+		{
+			insert(begin(), std::move(val));
+		}
+
+		void pop_back()
+		{
+			if (empty())
+				throw exception("Cannot pop element from empty list");
+			erase(iterator(this, tail.prev, _block(tail.prev)->count - 1));
+		}
+		void pop_front()
+		{
+			if (empty())
+				throw exception("Cannot pop element from empty list");
+			erase(begin());
+		}
+
+		//a block that falls below half its capacity takes in the next block if they fit together
+		iterator erase(iterator position)
+		{
+			if (position.block == &head || position.block == &tail)
+				throw out_of_bounds("Tried to delete element out of bounds");
+			_validateIterator(position);
+			Block* block = _block(position.block);
+			size_t index = position.index;
+			_eraseItem(block, index);
+			v_size--;
+			if (block->count == 0)
+			{
+				BlockBase* next = block->next;
+				_freeBlock(block);
+				return iterator(this, next, 0);
+			}
+			if (block->count < BlockSize / 2 && block->next != &tail)
+			{
+				Block* next = _block(block->next);
+				if (block->count + next->count <= BlockSize)
+				{
+					_moveItems(next, 0, block);
+					_freeBlock(next);
+				}
+			}
+			if (index < block->count)
+				return iterator(this, block, index);
+			return iterator(this, block->next, 0);
+		}
+		iterator erase(iterator firstIt, iterator lastIt)
+		{
+			_validateIterator(firstIt);
+			_validateIterator(lastIt);
+			//merging blocks invalidates lastIt, so erase by count
+			size_t count = 0;
+			for (iterator it = firstIt; it != lastIt; ++it)
+				count++;
+			for (size_t i = 0; i < count; i++)
+				firstIt = erase(firstIt);
+			return firstIt;
+		}
+
+		void resize(size_t size, const T& val = T())
+		{
+			while (v_size > size)
+				pop_back();
+			while (v_size < size)
+				push_back(val);
+		}
+
+		//the blocks of list are relinked in O(1), only the block at position may have to be split
+		void splice(iterator position, MyUnrolledList& list)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_validateIterator(position);
+			BlockBase* before = nullptr;
+			if (position.block == &tail)
+				before = tail.prev;
+			else if (position.index == 0)
+				before = position.block->prev;
+			else
+			{
+				_splitBlock(_block(position.block), position.index);
+				before = position.block;
+			}
+			BlockBase* after = before->next;
+			before->next = list.head.next;
+			list.head.next->prev = before;
+			after->prev = list.tail.prev;
+			list.tail.prev->next = after;
+			v_size += list.v_size;
+			list.head.next = &list.tail;
+			list.tail.prev = &list.head;
+			list.v_size = 0;
+		}
+		void splice(iterator position, MyUnrolledList&& list)
+		{
+			splice(position, list);
+		}
+		void splice(iterator position, MyUnrolledList& list, iterator from)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_validateIterator(position);
+			_validateIterator(from, &list);
+			insert(position, std::move(*from));
+			list.erase(from);
+		}
+		void splice(iterator position, MyUnrolledList&& list, iterator from)
+		{
+			splice(position, list, from);
+		}
+		//elements are moved one by one, as the range may start and end in the middle of blocks
+		void splice(iterator position, MyUnrolledList& list, iterator firstIt, iterator lastIt)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_validateIterator(position);
+			_validateIterator(firstIt, &list);
+			_validateIterator(lastIt, &list);
+			size_t count = 0;
+			for (iterator it = firstIt; it != lastIt; ++it)
+				count++;
+			for (size_t i = 0; i < count; i++)
+			{
+				position = ++insert(position, std::move(*firstIt));
+				firstIt = list.erase(firstIt);
+			}
+		}
+		void splice(iterator position, MyUnrolledList&& list, iterator firstIt, iterator lastIt)
+		{
+			splice(position, list, firstIt, lastIt);
+		}
+
+		void remove(const T& val)
+		{
+			for (iterator it = begin(), stop = end(); it != stop;)
+			{
+				if (*it == val)
+				{
+					it = erase(it);
+					stop = end();
+				}
+				else
+					++it;
+			}
+		}
+		void remove_if(std::function<bool(const T&)> Comp)
+		{
+			for (iterator it = begin(), stop = end(); it != stop;)
+			{
+				if (Comp(*it))
+				{
+					it = erase(it);
+					stop = end();
+				}
+				else
+					++it;
+			}
+		}
+
+		//merge sort, halves are split off by relinking blocks and every block is sorted by insertion sort
+		void sort()
+		{
+			_sort([](const T& x, const T& y) { return x < y; });
+		}
+		void sort(std::function<bool(const T&, const T&)> Comp)
+		{
+			_sort(Comp);
+		}
+
+		void merge(MyUnrolledList& list)
+		{
+			merge(list, [](const T& x, const T& y) { return x < y; });
+		}
+		void merge(MyUnrolledList&& list)
+		{
+			merge(list);
+		}
+		void merge(MyUnrolledList& list, std::function<bool(const T&, const T&)> Comp)
+		{
+			if (list.empty() || &list == this)
+				return;
+			_sort(Comp);
+			list._sort(Comp);
+			_mergeSorted(list, Comp);
+		}
+		void merge(MyUnrolledList&& list, std::function<bool(const T&, const T&)> Comp)
+		{
+			merge(list, Comp);
+		}
+
+		void reverse()
+		{
+			if (empty())
+				return;
+			BlockBase* first = head.next;
+			BlockBase* last = tail.prev;
+			BlockBase* block = first;
+			while (block != &tail)
+			{
+				BlockBase* temp = block->next;
+				block->next = block->prev;
+				block->prev = temp;
+				T* items = _block(block)->items();
+				for (size_t i = 0, j = _block(block)->count - 1; i < j; i++, j--)
+					std::swap(items[i], items[j]);
+				block = temp;
+			}
+			head.next = last;
+			last->prev = &head;
+			tail.prev = first;
+			first->next = &tail;
+		}
+	private:
+		static Block* _block(BlockBase* block)
+		{
+			return static_cast<Block*>(block);
+		}
+		//moves all blocks of the donor behind our sentinels, we must be empty
+		void _takeBlocks(MyUnrolledList& donor) noexcept
+		{
+			if (donor.head.next == &donor.tail)
+				return;
+			head.next = donor.head.next;
+			head.next->prev = &head;
+			tail.prev = donor.tail.prev;
+			tail.prev->next = &tail;
+			v_size = donor.v_size;
+			donor.head.next = &donor.tail;
+			donor.tail.prev = &donor.head;
+			donor.v_size = 0;
+		}
+		Block* _newBlock(BlockBase* prev)
+		{
+			Block* block = new Block(prev, prev->next);
+			prev->next->prev = block;
+			prev->next = block;
+			return block;
+		}
+		//the block has to be empty already
+		void _freeBlock(Block* block)
+		{
+			block->prev->next = block->next;
+			block->next->prev = block->prev;
+			delete block;
+		}
+		void _destroyItems(Block* block, size_t from)
+		{
+			T* items = block->items();
+			for (size_t i = from; i < block->count; i++)
+				items[i].~T();
+			block->count = from;
+		}
+		//move the items from index on to the end of target
+		void _moveItems(Block* source, size_t from, Block* target)
+		{
+			T* items = source->items();
+			T* targetItems = target->items();
+			for (size_t i = from; i < source->count; i++)
+				new (&targetItems[target->count++]) T(std::move(items[i]));
+			_destroyItems(source, from);
+		}
+		//move the items from index on into a new block behind this one
+		Block* _splitBlock(Block* block, size_t index)
+		{
+			Block* upper = _newBlock(block);
+			_moveItems(block, index, upper);
+			return upper;
+		}
+		void _insertItem(Block* block, size_t index, T&& val)
+		{
+			T* items = block->items();
+			if (index == block->count)
+				new (&items[index]) T(std::move(val));
+			else
+			{
+				new (&items[block->count]) T(std::move(items[block->count - 1]));
+				for (size_t i = block->count - 1; i > index; i--)
+					items[i] = std::move(items[i - 1]);
+				items[index] = std::move(val);
+			}
+			block->count++;
+		}
+		void _eraseItem(Block* block, size_t index)
+		{
+			T* items = block->items();
+			for (size_t i = index + 1; i < block->count; i++)
+				items[i - 1] = std::move(items[i]);
+			items[--block->count].~T();
+		}
+		//move everything behind the first count elements into rest, count has to be less than the size and rest empty
+		void _splitAt(size_t count, MyUnrolledList& rest)
+		{
+			size_t seen = 0;
+			BlockBase* block = head.next;
+			while (seen + _block(block)->count <= count)
+			{
+				seen += _block(block)->count;
+				block = block->next;
+			}
+			if (seen < count)
+				block = _splitBlock(_block(block), count - seen);
+			rest.head.next = block;
+			rest.tail.prev = tail.prev;
+			tail.prev = block->prev;
+			tail.prev->next = &tail;
+			block->prev = &rest.head;
+			rest.tail.prev->next = &rest.tail;
+			rest.v_size = v_size - count;
+			v_size = count;
+		}
+		void _sort(const std::function<bool(const T&, const T&)>& Comp)
+		{
+			if (v_size < 2)
+				return;
+			if (head.next == tail.prev)
+			{
+				T* items = _block(head.next)->items();
+				for (size_t i = 1; i < v_size; i++)
+				{
+					for (size_t j = i; j > 0 && Comp(items[j], items[j - 1]); j--)
+						std::swap(items[j], items[j - 1]);
+				}
+				return;
+			}
+			MyUnrolledList second;
+			_splitAt(v_size / 2, second);
+			_sort(Comp);
+			second._sort(Comp);
+			_mergeSorted(second, Comp);
+		}
+		//both lists have to be sorted, the merged elements are moved into freshly filled blocks
+		void _mergeSorted(MyUnrolledList& list, const std::function<bool(const T&, const T&)>& Comp)
+		{
+			MyUnrolledList merged;
+			iterator it1 = begin(), stop1 = end();
+			iterator it2 = list.begin(), stop2 = list.end();
+			while (it1 != stop1 && it2 != stop2)
+			{
+				if (Comp(*it2, *it1))
+				{
+					merged.push_back(std::move(*it2));
+					++it2;
+				}
+				else
+				{
+					merged.push_back(std::move(*it1));
+					++it1;
+				}
+			}
+			for (; it1 != stop1; ++it1)
+				merged.push_back(std::move(*it1));
+			for (; it2 != stop2; ++it2)
+				merged.push_back(std::move(*it2));
+			list.clear();
+			*this = std::move(merged);
+		}
+		void _validateIterator(const iterator& it)
+		{
+			if (it.list != this)
+				throw bad_iterator("Tried to pass iterator of other list");
+		}
+		void _validateIterator(const iterator& it, MyUnrolledList* list)
+		{
+			if (it.list != list)
+				throw bad_iterator("Tried to pass iterator from wrong list");
+		}
+	};
+}
\ No newline at end of file
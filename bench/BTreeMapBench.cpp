@@ -0,0 +1,119 @@
+//benchmark of MyBTreeMap against std::map, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\BTreeMapBench.cpp
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+#include "../MyVector.h"
+#include "../MyBTreeMap.h"
+
+using namespace MySTL;
+
+template<typename Func>
+static double measure(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+//the same order as std::less, but not std::less itself, so the nodes are searched by binary search instead of SIMD
+template<typename K>
+struct PlainLess
+{
+	bool operator()(const K& a, const K& b) const
+	{
+		return a < b;
+	}
+};
+
+static void printRow(const char* name, double insert, double find, double scan)
+{
+	std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1)
+		<< " insert " << std::setw(7) << insert << "  find " << std::setw(7) << find << "  scan " << std::setw(6) << scan;
+}
+
+//random inserts, finds of every key, a full scan and a bulk load of the sorted keys
+template<typename K, class Comp>
+static void btree(const char* name, const std::vector<K>& keys)
+{
+	uint64_t sink = 0;
+	MyBTreeMap<K, uint64_t, Comp> map;
+	double insert = measure([&] {
+		for (K key : keys)
+			map.try_emplace(key, uint64_t(key));
+	});
+	double find = measure([&] {
+		for (K key : keys)
+			sink += map.find(key).value();
+	});
+	double scan = measure([&] {
+		for (int round = 0; round < 10; round++)
+			map.forEach([&](const K&, const uint64_t& val) { sink += val; });
+	}) / 10;
+
+	std::vector<K> sorted(keys);
+	std::sort(sorted.begin(), sorted.end());
+	sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+	MyVector<std::pair<K, uint64_t>> pairs;
+	pairs.reserve(sorted.size());
+	for (K key : sorted)
+		pairs.push_back(std::make_pair(key, uint64_t(key)));
+	size_t loaded = 0;
+	double bulk = measure([&] {
+		MyBTreeMap<K, uint64_t, Comp> built(pairs);
+		loaded = built.size();
+	});
+	printRow(name, insert, find, scan);
+	std::cout << "  bulk load " << std::setw(5) << bulk << " ms (" << ((sink + loaded) & 1) << ")\n";
+}
+template<typename K>
+static void stdMap(const std::vector<K>& keys)
+{
+	uint64_t sink = 0;
+	std::map<K, uint64_t> map;
+	double insert = measure([&] {
+		for (K key : keys)
+			map.try_emplace(key, uint64_t(key));
+	});
+	double find = measure([&] {
+		for (K key : keys)
+			sink += map.find(key)->second;
+	});
+	double scan = measure([&] {
+		for (int round = 0; round < 10; round++)
+		{
+			for (auto& entry : map)
+				sink += entry.second;
+		}
+	}) / 10;
+	printRow("std::map", insert, find, scan);
+	std::cout << " ms (" << (sink & 1) << ")\n";
+}
+
+int main()
+{
+	const size_t count = 1000000;
+	std::mt19937_64 rng(3);
+	std::vector<uint64_t> keys64(count);
+	std::vector<int32_t> keys32(count);
+	for (size_t i = 0; i < count; i++)
+		keys64[i] = rng();
+	for (size_t i = 0; i < count; i++)
+		keys32[i] = int32_t(rng());
+
+	std::cout << "1M random u64 keys, ms\n";
+	btree<uint64_t, std::less<uint64_t>>("MyBTreeMap", keys64);
+	btree<uint64_t, PlainLess<uint64_t>>("(binary search)", keys64);
+	stdMap(keys64);
+	std::cout << "1M random i32 keys, ms\n";
+	btree<int32_t, std::less<int32_t>>("MyBTreeMap", keys32);
+	btree<int32_t, PlainLess<int32_t>>("(binary search)", keys32);
+	stdMap(keys32);
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+//contention benchmark of MyConcurrentQueue against a MyList guarded by a mutex, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\ConcurrentQueueBench.cpp
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../MyList.h"
+#include "../MyConcurrentQueue.h"
+
+using namespace MySTL;
+
+//the same push and try_pop as the queue, every call takes the one lock
+template<typename T>
+class LockedList
+{
+private:
+	std::mutex mutex;
+	MyList<T> list;
+public:
+	void push(const T& val)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		list.push_back(val);
+	}
+	bool try_pop(T& val)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (list.empty())
+			return false;
+		val = list.front();
+		list.pop_front();
+		return true;
+	}
+};
+
+//every thread alternates a push and a pop, so all of them hit both ends of the queue at once.
+//returns millions of operations per second over all threads
+template<class Queue>
+static double run(unsigned threads, size_t total)
+{
+	Queue queue;
+	std::atomic<bool> start(false);
+	std::vector<std::thread> workers;
+	size_t perThread = total / threads;
+	for (unsigned t = 0; t < threads; t++)
+	{
+		workers.emplace_back([&] {
+			while (!start.load())
+				std::this_thread::yield();
+			long val;
+			for (size_t i = 0; i < perThread; i++)
+			{
+				queue.push(long(i));
+				while (!queue.try_pop(val))
+					std::this_thread::yield();
+			}
+		});
+	}
+	auto begin = std::chrono::steady_clock::now();
+	start.store(true);
+	for (auto& worker : workers)
+		worker.join();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	return 2.0 * perThread * threads / seconds / 1e6;
+}
+
+int main()
+{
+	const size_t total = 2000000;
+	unsigned maxThreads = std::thread::hardware_concurrency();
+	if (maxThreads == 0)
+		maxThreads = 1;
+	std::cout << total << " push/pop pairs split over the threads, Mops/s\n";
+	for (unsigned threads = 1; threads <= maxThreads; threads++)
+	{
+		double lockFree = run<MyConcurrentQueue<long>>(threads, total);
+		double locked = run<LockedList<long>>(threads, total);
+		std::cout << std::setw(3) << threads << " threads  MyConcurrentQueue " << std::fixed << std::setprecision(1) << std::setw(7) << lockFree
+			<< "  mutex + MyList " << std::setw(7) << locked << "\n";
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+//benchmark of MyHashMap against std::unordered_map, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\HashMapBench.cpp
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../MyHashMap.h"
+
+using namespace MySTL;
+
+template<typename Func>
+static double measure(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+//inserts count keys, looks them up in random order, looks up as many missing keys, iterates and erases everything
+template<class Map, class KeyGen>
+static void run(const char* name, KeyGen keyOf, size_t count)
+{
+	std::vector<decltype(keyOf(0))> keys, missing;
+	for (size_t i = 0; i < count; i++)
+	{
+		keys.push_back(keyOf(i));
+		missing.push_back(keyOf(i + count));
+	}
+	std::mt19937 rng(3);
+	std::vector<size_t> order(count);
+	for (size_t i = 0; i < count; i++)
+		order[i] = rng() % count;
+
+	Map map;
+	size_t sink = 0;
+	double insert = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			map[keys[i]] = i;
+	});
+	double hit = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			sink += map.find(keys[order[i]])->second;
+	});
+	double miss = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			sink += map.count(missing[i]);
+	});
+	double iterate = measure([&] {
+		for (auto& entry : map)
+			sink += entry.second;
+	});
+	double erase = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			sink += map.erase(keys[i]);
+	});
+	std::cout << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+		<< " insert " << std::setw(7) << insert << "  hit " << std::setw(7) << hit << "  miss " << std::setw(7) << miss
+		<< "  iterate " << std::setw(6) << iterate << "  erase " << std::setw(7) << erase << " ms (" << sink % 7 << ")\n";
+}
+
+int main()
+{
+	const size_t count = 1000000;
+	auto intKey = [](size_t i) { return uint64_t(i) * 2654435761u; };
+	auto stringKey = [](size_t i) { return "key_" + std::to_string(i * 7919); };
+	run<std::unordered_map<uint64_t, uint64_t>>("unordered_map<u64>", intKey, count);
+	run<MyHashMap<uint64_t, uint64_t>>("MyHashMap<u64>", intKey, count);
+	run<std::unordered_map<std::string, uint64_t>>("unordered_map<string>", stringKey, count);
+	run<MyHashMap<std::string, uint64_t>>("MyHashMap<string>", stringKey, count);
+	return 0;
+}
\ No newline at end of file
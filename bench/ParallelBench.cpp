@@ -0,0 +1,83 @@
+//scaling benchmark of the MyParallel algorithms on pools of 1 to hardware_concurrency threads, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\ParallelBench.cpp
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "../MyVector.h"
+#include "../MyParallel.h"
+
+using namespace MySTL;
+
+template<typename Func>
+static double measure(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+//the best of a few rounds, so a single descheduled round does not hide the scaling
+template<typename Func>
+static double best(Func func)
+{
+	double result = measure(func);
+	for (int round = 1; round < 5; round++)
+	{
+		double time = measure(func);
+		if (time < result)
+			result = time;
+	}
+	return result;
+}
+
+int main()
+{
+	const size_t count = 16000000;
+	MyVector<double> in, out;
+	in.reserve(count);
+	out.reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		in.push_back(double(i % 1000) / 7);
+		out.push_back(0);
+	}
+
+	unsigned maxThreads = std::thread::hardware_concurrency();
+	if (maxThreads == 0)
+		maxThreads = 1;
+	double sink = 0;
+	double base[4] = {};
+	std::cout << count << " doubles, best of 5 in ms, speedup over 1 thread in brackets\n";
+	for (unsigned threads = 1; threads <= maxThreads; threads++)
+	{
+		MyThreadPool pool(threads);
+		double times[4];
+		times[0] = best([&] {
+			sink += par_reduce(pool, in, 0.0, [](double a, double b) { return a + b; });
+		});
+		times[1] = best([&] {
+			par_transform(pool, in, out, [](double x) { return std::sqrt(x) * 3 + 1; });
+		});
+		times[2] = best([&] {
+			sink += double(par_count_if(pool, in, [](double x) { return x > 70; }));
+		});
+		times[3] = best([&] {
+			par_inclusive_scan(pool, in, out, [](double a, double b) { return a + b; });
+		});
+		if (threads == 1)
+		{
+			for (int i = 0; i < 4; i++)
+				base[i] = times[i];
+		}
+
+		const char* names[4] = { "reduce", "transform", "count_if", "scan" };
+		std::cout << std::setw(3) << threads << " threads" << std::fixed << std::setprecision(1);
+		for (int i = 0; i < 4; i++)
+			std::cout << "  " << names[i] << " " << std::setw(6) << times[i] << " (" << std::setprecision(2) << base[i] / times[i] << ")" << std::setprecision(1);
+		std::cout << "\n";
+	}
+	std::cout << "(" << (sink + out[count - 1] > 0) << ")\n";
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,157 @@
+//benchmark of MyPersistentVector snapshots against copying MyVector, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\PersistentVectorBench.cpp
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <new>
+#include <random>
+#include "../MyVector.h"
+#include "../MyPersistentVector.h"
+
+using namespace MySTL;
+
+//counts the heap bytes in use so the memory kept alive by old snapshots can be reported
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+void* operator new(size_t size)
+{
+	size_t* block = static_cast<size_t*>(std::malloc(size + 16));
+	if (block == nullptr)
+		throw std::bad_alloc();
+	*block = size;
+	liveBytes += size;
+	if (liveBytes > peakBytes)
+		peakBytes = liveBytes;
+	return reinterpret_cast<char*>(block) + 16;
+}
+void operator delete(void* memory) noexcept
+{
+	if (memory == nullptr)
+		return;
+	size_t* block = reinterpret_cast<size_t*>(static_cast<char*>(memory) - 16);
+	liveBytes -= *block;
+	std::free(block);
+}
+void operator delete(void* memory, size_t) noexcept
+{
+	operator delete(memory);
+}
+
+template<typename Func>
+static double measure(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+//a state of stateSize elements gets changesPerTick random sets per tick, the last kept snapshots stay alive
+static const size_t stateSize = 100000;
+static const size_t changesPerTick = 64;
+static const size_t kept = 100;
+static const size_t ticks = 2000;
+
+static void snapshotsByCopy()
+{
+	std::mt19937 rng(1);
+	MyVector<int> state;
+	state.reserve(stateSize);
+	for (size_t i = 0; i < stateSize; i++)
+		state.push_back(int(i));
+	std::deque<MyVector<int>> snapshots;
+	size_t base = liveBytes;
+	peakBytes = liveBytes;
+	double time = measure([&] {
+		for (size_t tick = 0; tick < ticks; tick++)
+		{
+			for (size_t k = 0; k < changesPerTick; k++)
+				state[rng() % stateSize] = int(tick);
+			snapshots.push_back(state);
+			if (snapshots.size() > kept)
+				snapshots.pop_front();
+		}
+	});
+	std::cout << "MyVector copies:     " << time << " ms, " << (peakBytes - base) / 1e6 << " MB retained\n";
+}
+static void snapshotsPersistent()
+{
+	std::mt19937 rng(1);
+	MyPersistentVector<int> state;
+	{
+		auto transient = state.transient();
+		for (size_t i = 0; i < stateSize; i++)
+			transient.push_back(int(i));
+		state = transient.persistent();
+	}
+	std::deque<MyPersistentVector<int>> snapshots;
+	size_t base = liveBytes;
+	peakBytes = liveBytes;
+	double time = measure([&] {
+		for (size_t tick = 0; tick < ticks; tick++)
+		{
+			auto transient = state.transient();
+			for (size_t k = 0; k < changesPerTick; k++)
+				transient.set(rng() % stateSize, int(tick));
+			state = transient.persistent();
+			snapshots.push_back(state);
+			if (snapshots.size() > kept)
+				snapshots.pop_front();
+		}
+	});
+	std::cout << "MyPersistentVector:  " << time << " ms, " << (peakBytes - base) / 1e6 << " MB retained (one transient per tick)\n";
+}
+//plain appends, reads and conversions of 1M elements
+static void basics()
+{
+	const size_t count = 1000000;
+	long sink = 0;
+	MyVector<int> vec;
+	MyPersistentVector<int> persistent, built, converted;
+	MyVector<int> back;
+	double vecPush = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			vec.push_back(int(i));
+	});
+	double persistentPush = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			persistent = persistent.push_back(int(i));
+	});
+	double transientPush = measure([&] {
+		auto transient = MyPersistentVector<int>().transient();
+		for (size_t i = 0; i < count; i++)
+			transient.push_back(int(i));
+		built = transient.persistent();
+	});
+	double vecRead = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			sink += vec[(i * 7919) % count];
+	});
+	double persistentRead = measure([&] {
+		for (size_t i = 0; i < count; i++)
+			sink += built[(i * 7919) % count];
+	});
+	double iterate = measure([&] {
+		for (int val : built)
+			sink += val;
+	});
+	double fromVector = measure([&] {
+		converted = MyPersistentVector<int>(vec);
+	});
+	double toVector = measure([&] {
+		back = converted.toVector();
+	});
+	std::cout << "1M push_back: MyVector " << vecPush << " ms, persistent " << persistentPush << " ms, transient " << transientPush << " ms\n"
+		<< "1M random reads: MyVector " << vecRead << " ms, persistent " << persistentRead << " ms, iteration " << iterate << " ms\n"
+		<< "1M conversion: from MyVector " << fromVector << " ms, toVector " << toVector << " ms ("
+		<< sink + long(back.size()) + long(persistent.size()) << ")\n";
+}
+
+int main()
+{
+	snapshotsByCopy();
+	snapshotsPersistent();
+	basics();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+//benchmark of single field scans over MySoAVector against an array of structs in MyVector, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\SoAVectorBench.cpp
+#include <iostream>
+#include <chrono>
+#include "../MyVector.h"
+#include "../MySoAVector.h"
+
+using namespace MySTL;
+
+//8 fields in 32 bytes, a scan over mass uses 4 of them
+struct Particle
+{
+	float x, y, z, vx, vy, vz, mass;
+	int id;
+};
+
+template<typename Func>
+static double measure(Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+	const size_t count = 10000000;
+	MyVector<Particle> aos;
+	MySoAVector<float, float, float, float, float, float, float, int> soa;
+	aos.reserve(count);
+	soa.reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		Particle p{ 1, 2, 3, 4, 5, 6, float(i & 7), int(i) };
+		aos.push_back(p);
+		soa.push_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id);
+	}
+
+	//the first round warms the caches and page tables, the second is the one to compare
+	for (int round = 0; round < 2; round++)
+	{
+		float aosSum = 0, soaSum = 0;
+		double aosTime = measure([&] {
+			const Particle* data = aos.getData();
+			for (size_t i = 0; i < count; i++)
+				aosSum += data[i].mass;
+		});
+		double soaTime = measure([&] {
+			for (float mass : soa.column<6>())
+				soaSum += mass;
+		});
+		std::cout << "sum of mass over " << count << " particles: AoS MyVector<Particle> " << aosTime
+			<< " ms, SoA column<6>() " << soaTime << " ms (" << aosSum << " " << soaSum << ")\n";
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+//benchmark of scans over MyUnrolledList against MyList, not part of MySTL.vcxproj.
+//build with optimizations from a developer prompt: cl /std:c++17 /EHsc /O2 bench\UnrolledListBench.cpp
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "../MyList.h"
+#include "../MyUnrolledList.h"
+
+using namespace MySTL;
+
+//sums every element ten times and reports the time of one scan
+template<class List>
+static void scan(const char* name, List& list)
+{
+	long long sum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < 10; round++)
+	{
+		for (auto& val : list)
+			sum += val;
+	}
+	double time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 10;
+	std::cout << "  " << name << " " << time << " ms per scan (" << sum << ")\n";
+}
+
+int main()
+{
+	const int count = 4000000;
+	{
+		//nodes allocated one after another, the best case for MyList
+		MyList<int> list;
+		MyUnrolledList<int, 32> unrolled;
+		for (int i = 0; i < count; i++)
+		{
+			list.push_back(i);
+			unrolled.push_back(i);
+		}
+		std::cout << "sum of " << count << " ints, nodes contiguous\n";
+		scan("MyList", list);
+		scan("MyUnrolledList<int, 32>", unrolled);
+	}
+	{
+		//the nodes come from many lists filled in random order and spliced together,
+		//so neighbours are far apart in memory like in a long lived heap
+		std::mt19937 rng(3);
+		std::vector<MyList<int>> parts(4096);
+		MyList<int> list;
+		MyUnrolledList<int, 32> unrolled;
+		for (int i = 0; i < count; i++)
+		{
+			parts[rng() % parts.size()].push_back(i);
+			unrolled.push_back(i);
+		}
+		for (auto& part : parts)
+			list.splice(list.end(), part);
+		std::cout << "sum of " << count << " ints, nodes interleaved across the heap\n";
+		scan("MyList", list);
+		scan("MyUnrolledList<int, 32>", unrolled);
+	}
+	return 0;
+}
\ No newline at end of file
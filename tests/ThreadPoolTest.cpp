@@ -0,0 +1,70 @@
+//regression tests for MyThreadPool, not part of MySTL.vcxproj. build and run on its own from a developer prompt:
+//cl /std:c++17 /EHsc /O2 tests\ThreadPoolTest.cpp && ThreadPoolTest.exe
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <thread>
+#include "../MyThreadPool.h"
+
+using MySTL::MyThreadPool;
+
+//every index of [0, count) has to be handed out exactly once
+static bool coversOnce(MyThreadPool& pool, size_t count, size_t minGrain)
+{
+	std::unique_ptr<std::atomic<unsigned char>[]> seen(new std::atomic<unsigned char>[count]);
+	for (size_t i = 0; i < count; i++)
+		seen[i].store(0, std::memory_order_relaxed);
+	pool.parallel_for(count, minGrain, [&](size_t first, size_t last, size_t) {
+		for (size_t i = first; i < last; i++)
+			seen[i].fetch_add(1, std::memory_order_relaxed);
+	});
+	for (size_t i = 0; i < count; i++)
+	{
+		if (seen[i].load(std::memory_order_relaxed) != 1)
+			return false;
+	}
+	return true;
+}
+
+//more participants than cores and a body that finishes instantly, so every participant keeps doubling its grain.
+//the grain used to overflow to 0 after about 64 chunks and parallel_for never returned
+static bool grainStaysBounded()
+{
+	size_t cores = std::thread::hardware_concurrency();
+	MyThreadPool pool(cores == 0 ? 8 : cores * 4 + 4);
+	for (size_t rep = 0; rep < 200; rep++)
+	{
+		if (!coversOnce(pool, 1 + rep * 997, 1))
+			return false;
+	}
+	for (size_t count : { size_t(1), size_t(2), size_t(63), size_t(100000) })
+	{
+		for (size_t minGrain : { size_t(0), size_t(1), size_t(7), size_t(1000) })
+		{
+			if (!coversOnce(pool, count, minGrain))
+				return false;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	//a hang is the failure this guards against, so the tests run on their own thread under a time limit
+	auto result = std::async(std::launch::async, grainStaysBounded);
+	if (result.wait_for(std::chrono::seconds(120)) != std::future_status::ready)
+	{
+		std::cerr << "ThreadPoolTest: parallel_for did not return\n";
+		std::_Exit(1);
+	}
+	if (!result.get())
+	{
+		std::cerr << "ThreadPoolTest: an index was not handed out exactly once\n";
+		return 1;
+	}
+	std::cout << "ThreadPoolTest: ok\n";
+	return 0;
+}
\ No newline at end of file